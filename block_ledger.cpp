@@ -0,0 +1,668 @@
+#include "block_ledger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <iostream>
+
+// Integers are stored in host byte order
+static const char BLOCK_LEDGER_MAGIC[4] = {'M', 'B', 'L', 'K'};
+static const uint32_t BLOCK_LEDGER_VERSION = 2;
+
+namespace {
+
+void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const uint8_t*& pos, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; pos < end && shift < 64; shift += 7) {
+        uint8_t byte = *pos++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+void putRaw(std::vector<uint8_t>& out, T value) {
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+bool getRaw(const uint8_t*& pos, const uint8_t* end, T& value) {
+    if (end - pos < static_cast<std::ptrdiff_t>(sizeof(T))) {
+        return false;
+    }
+    std::memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+void putString(std::vector<uint8_t>& out, const std::string& text) {
+    putVarint(out, text.size());
+    out.insert(out.end(), text.begin(), text.end());
+}
+
+bool getString(const uint8_t*& pos, const uint8_t* end, std::string& text) {
+    uint64_t length;
+    if (!getVarint(pos, end, length) || length > static_cast<uint64_t>(end - pos)) {
+        return false;
+    }
+    text.assign(reinterpret_cast<const char*>(pos), length);
+    pos += length;
+    return true;
+}
+
+// Minimal LZ77 codec. The stream is a sequence of
+//   literal length, literals, match length, match offset
+// and ends with a match length of 0.
+std::vector<uint8_t> lzCompress(const std::string& input) {
+    const size_t MIN_MATCH = 4;
+    const int HASH_BITS = 12;
+    const size_t MAX_OFFSET = 65535;
+
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(input.data());
+    size_t n = input.size();
+    std::vector<uint8_t> out;
+    std::vector<int64_t> table(size_t(1) << HASH_BITS, -1);
+
+    size_t anchor = 0, i = 0;
+    while (i + MIN_MATCH <= n) {
+        uint32_t sequence;
+        std::memcpy(&sequence, in + i, sizeof(sequence));
+        uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+        int64_t candidate = table[hash];
+        table[hash] = static_cast<int64_t>(i);
+
+        if (candidate >= 0 && i - candidate <= MAX_OFFSET &&
+            std::memcmp(in + candidate, in + i, MIN_MATCH) == 0) {
+            size_t length = MIN_MATCH;
+            while (i + length < n && in[candidate + length] == in[i + length]) {
+                length++;
+            }
+
+            putVarint(out, i - anchor);
+            out.insert(out.end(), in + anchor, in + i);
+            putVarint(out, length);
+            putVarint(out, i - candidate);
+
+            i += length;
+            anchor = i;
+        } else {
+            i++;
+        }
+    }
+
+    putVarint(out, n - anchor);
+    out.insert(out.end(), in + anchor, in + n);
+    putVarint(out, 0);
+    return out;
+}
+
+bool lzDecompress(const uint8_t* pos, const uint8_t* end, size_t rawSize, std::string& out) {
+    out.clear();
+    out.reserve(rawSize);
+
+    while (true) {
+        uint64_t literals, length, offset;
+        if (!getVarint(pos, end, literals) || literals > static_cast<uint64_t>(end - pos)) {
+            return false;
+        }
+        out.append(reinterpret_cast<const char*>(pos), literals);
+        pos += literals;
+
+        if (!getVarint(pos, end, length)) {
+            return false;
+        }
+        if (length == 0) {
+            return out.size() == rawSize;
+        }
+        if (!getVarint(pos, end, offset) || offset == 0 || offset > out.size() ||
+            out.size() + length > rawSize) {
+            return false;
+        }
+
+        // Byte by byte: the match may overlap the bytes it produces
+        size_t from = out.size() - offset;
+        for (uint64_t k = 0; k < length; k++) {
+            out.push_back(out[from + k]);
+        }
+    }
+}
+
+void setBit(std::vector<uint8_t>& bits, uint32_t id) {
+    if (bits.size() <= id / 8) {
+        bits.resize(id / 8 + 1, 0);
+    }
+    bits[id / 8] |= static_cast<uint8_t>(1u << (id % 8));
+}
+
+bool testBit(const std::vector<uint8_t>& bits, uint32_t id) {
+    return id / 8 < bits.size() && (bits[id / 8] & (1u << (id % 8)));
+}
+
+std::string intToDate(uint32_t value) {
+    if (value == 0) {
+        return "";
+    }
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%04u-%02u-%02u",
+                  value / 10000, (value / 100) % 100, value % 100);
+    return buffer;
+}
+
+}
+
+BlockLedgerFile::BlockLedgerFile(size_t cacheBytesLimit)
+    : rowCount(0), cacheBudget(cacheBytesLimit), cacheBytes(0), blocksRead(0) {}
+
+uint32_t BlockLedgerFile::dateToInt(const std::string& date) {
+    // YYYY-MM-DD -> YYYYMMDD, anything else -> 0
+    if (date.size() != 10 || date[4] != '-' || date[7] != '-') {
+        return 0;
+    }
+    uint32_t value = 0;
+    for (size_t i = 0; i < date.size(); i++) {
+        if (i == 4 || i == 7) {
+            continue;
+        }
+        if (date[i] < '0' || date[i] > '9') {
+            return 0;
+        }
+        value = value * 10 + (date[i] - '0');
+    }
+    return value;
+}
+
+BlockLedgerWriter::BlockLedgerWriter(uint32_t blockRows)
+    : rowsPerBlock(blockRows ? blockRows : BLOCK_LEDGER_ROWS_PER_BLOCK), offset(0) {}
+
+bool BlockLedgerWriter::open(const std::string& file) {
+    out.open(file, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Error: Unable to open " << file << " for writing" << std::endl;
+        return false;
+    }
+
+    typeIds.clear();
+    categoryIds.clear();
+    currencyIds.clear();
+    infos.clear();
+    pending.clear();
+
+    out.write(BLOCK_LEDGER_MAGIC, sizeof(BLOCK_LEDGER_MAGIC));
+    out.write(reinterpret_cast<const char*>(&BLOCK_LEDGER_VERSION), sizeof(BLOCK_LEDGER_VERSION));
+    offset = sizeof(BLOCK_LEDGER_MAGIC) + sizeof(BLOCK_LEDGER_VERSION);
+    return true;
+}
+
+void BlockLedgerWriter::append(const Transaction& row) {
+    pending.push_back(row);
+    if (pending.size() >= rowsPerBlock) {
+        flushBlock();
+    }
+}
+
+// Encodes and writes the pending rows as one block; only its zone map stays in memory
+void BlockLedgerWriter::flushBlock() {
+    if (pending.empty()) {
+        return;
+    }
+
+    BlockLedgerFile::BlockInfo info = {};
+    info.offset = offset;
+    info.rowCount = static_cast<uint32_t>(pending.size());
+
+    std::vector<uint32_t> typeColumn, categoryColumn, currencyColumn, dateColumn;
+    std::string descriptions;
+    std::vector<uint8_t> columns;
+
+    for (size_t i = 0; i < pending.size(); i++) {
+        const Transaction& row = pending[i];
+        float amount = row.getAmount();
+        uint32_t category = categoryIds.intern(row.getCategory());
+        uint32_t currency = currencyIds.intern(row.getCurrency());
+        uint32_t date = BlockLedgerFile::dateToInt(row.getDate());
+
+        putRaw(columns, amount);
+        typeColumn.push_back(typeIds.intern(row.getType()));
+        categoryColumn.push_back(category);
+        currencyColumn.push_back(currency);
+        dateColumn.push_back(date);
+
+        std::string description = row.getDescription();
+        std::vector<uint8_t> length;
+        putVarint(length, description.size());
+        descriptions.append(length.begin(), length.end());
+        descriptions += description;
+
+        // Undated rows never match a date filter, so they stay out of the date range
+        if (date != 0) {
+            bool firstDate = (info.maxDate == 0);
+            info.minDate = firstDate ? date : std::min(info.minDate, date);
+            info.maxDate = std::max(info.maxDate, date);
+        }
+
+        if (i == 0) {
+            info.minAmount = info.maxAmount = amount;
+        } else {
+            info.minAmount = std::min(info.minAmount, amount);
+            info.maxAmount = std::max(info.maxAmount, amount);
+        }
+        setBit(info.categoryBits, category);
+        setBit(info.currencyBits, currency);
+    }
+
+    for (const std::vector<uint32_t>* column : {&typeColumn, &categoryColumn, &currencyColumn}) {
+        for (uint32_t id : *column) {
+            putVarint(columns, id);
+        }
+    }
+
+    // Dates are mostly in order, so store zigzag deltas
+    int64_t previous = 0;
+    for (uint32_t date : dateColumn) {
+        int64_t delta = static_cast<int64_t>(date) - previous;
+        putVarint(columns, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+        previous = date;
+    }
+
+    std::vector<uint8_t> compressed = lzCompress(descriptions);
+    info.columnBytes = static_cast<uint32_t>(columns.size());
+    info.descriptionBytes = static_cast<uint32_t>(compressed.size());
+    info.descriptionRawBytes = static_cast<uint32_t>(descriptions.size());
+
+    out.write(reinterpret_cast<const char*>(columns.data()), columns.size());
+    out.write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+    offset += columns.size() + compressed.size();
+    infos.push_back(info);
+    pending.clear();
+}
+
+bool BlockLedgerWriter::close() {
+    if (!out.is_open()) {
+        return false;
+    }
+    flushBlock();
+
+    // Footer: dictionaries, block index, then its offset so readers can find it
+    std::vector<uint8_t> footer;
+    for (const StringInterner* dictionary : {&typeIds, &categoryIds, &currencyIds}) {
+        putVarint(footer, dictionary->size());
+        for (uint32_t id = 0; id < dictionary->size(); id++) {
+            putString(footer, dictionary->getString(id));
+        }
+    }
+
+    putVarint(footer, infos.size());
+    for (const auto& info : infos) {
+        putRaw(footer, info.offset);
+        putRaw(footer, info.rowCount);
+        putRaw(footer, info.columnBytes);
+        putRaw(footer, info.descriptionBytes);
+        putRaw(footer, info.descriptionRawBytes);
+        putRaw(footer, info.minAmount);
+        putRaw(footer, info.maxAmount);
+        putRaw(footer, info.minDate);
+        putRaw(footer, info.maxDate);
+        for (const std::vector<uint8_t>* bits : {&info.categoryBits, &info.currencyBits}) {
+            putVarint(footer, bits->size());
+            footer.insert(footer.end(), bits->begin(), bits->end());
+        }
+    }
+    putRaw(footer, offset);
+    footer.insert(footer.end(), BLOCK_LEDGER_MAGIC, BLOCK_LEDGER_MAGIC + sizeof(BLOCK_LEDGER_MAGIC));
+
+    out.write(reinterpret_cast<const char*>(footer.data()), footer.size());
+    bool ok = static_cast<bool>(out);
+    out.close();
+    return ok;
+}
+
+BlockLedgerWriter::~BlockLedgerWriter() {
+    if (out.is_open()) {
+        close();
+    }
+}
+
+bool BlockLedgerFile::write(const std::string& file, const std::vector<Transaction>& rows,
+                            uint32_t rowsPerBlock) {
+    BlockLedgerWriter writer(rowsPerBlock);
+    if (!writer.open(file)) {
+        return false;
+    }
+    for (const auto& row : rows) {
+        writer.append(row);
+    }
+    return writer.close();
+}
+
+bool BlockLedgerFile::writeFromCSV(const std::string& csvFile, const std::string& file,
+                                   uint32_t rowsPerBlock) {
+    std::ifstream in(csvFile);
+    if (!in.is_open()) {
+        std::cerr << "Error: Unable to open " << csvFile << std::endl;
+        return false;
+    }
+
+    BlockLedgerWriter writer(rowsPerBlock);
+    if (!writer.open(file)) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty()) {
+            writer.append(Transaction::fromCSV(line));
+        }
+    }
+    return writer.close();
+}
+
+bool BlockLedgerFile::open(const std::string& filename) {
+    path = filename;
+    file.close();
+    file.clear();
+    types.clear();
+    categories.clear();
+    currencies.clear();
+    blocks.clear();
+    rowCount = 0;
+    cacheOrder.clear();
+    cacheIndex.clear();
+    cacheBytes = 0;
+    blocksRead = 0;
+
+    file.open(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    char magic[sizeof(BLOCK_LEDGER_MAGIC)];
+    uint32_t version = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!file || std::memcmp(magic, BLOCK_LEDGER_MAGIC, sizeof(magic)) != 0 ||
+        version != BLOCK_LEDGER_VERSION) {
+        std::cerr << "Error: " << path << " is not a compressed ledger" << std::endl;
+        return false;
+    }
+
+    // Trailer: footer offset + magic
+    uint64_t footerOffset = 0;
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    std::streamoff trailerSize = sizeof(footerOffset) + sizeof(BLOCK_LEDGER_MAGIC);
+    if (fileSize < trailerSize) {
+        std::cerr << "Error: " << path << " is truncated" << std::endl;
+        return false;
+    }
+    file.seekg(fileSize - trailerSize);
+    file.read(reinterpret_cast<char*>(&footerOffset), sizeof(footerOffset));
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, BLOCK_LEDGER_MAGIC, sizeof(magic)) != 0 ||
+        footerOffset > static_cast<uint64_t>(fileSize - trailerSize)) {
+        std::cerr << "Error: " << path << " is truncated" << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> footer(fileSize - trailerSize - footerOffset);
+    file.seekg(footerOffset);
+    file.read(reinterpret_cast<char*>(footer.data()), footer.size());
+
+    const uint8_t* pos = footer.data();
+    const uint8_t* end = pos + footer.size();
+    bool ok = static_cast<bool>(file);
+
+    for (std::vector<std::string>* dictionary : {&types, &categories, &currencies}) {
+        uint64_t count = 0;
+        ok = ok && getVarint(pos, end, count);
+        for (uint64_t i = 0; ok && i < count; i++) {
+            std::string entry;
+            ok = getString(pos, end, entry);
+            dictionary->push_back(entry);
+        }
+    }
+
+    uint64_t blockCount = 0;
+    ok = ok && getVarint(pos, end, blockCount);
+    for (uint64_t i = 0; ok && i < blockCount; i++) {
+        BlockInfo info = {};
+        ok = getRaw(pos, end, info.offset) && getRaw(pos, end, info.rowCount) &&
+             getRaw(pos, end, info.columnBytes) && getRaw(pos, end, info.descriptionBytes) &&
+             getRaw(pos, end, info.descriptionRawBytes) &&
+             getRaw(pos, end, info.minAmount) && getRaw(pos, end, info.maxAmount) &&
+             getRaw(pos, end, info.minDate) && getRaw(pos, end, info.maxDate);
+        for (std::vector<uint8_t>* bits : {&info.categoryBits, &info.currencyBits}) {
+            uint64_t size = 0;
+            ok = ok && getVarint(pos, end, size) && size <= static_cast<uint64_t>(end - pos);
+            if (ok) {
+                bits->assign(pos, pos + size);
+                pos += size;
+            }
+        }
+        // Block bodies must lie before the footer, and every row takes at least
+        // a float plus one byte per varint column
+        ok = ok && info.offset + info.columnBytes + info.descriptionBytes <= footerOffset &&
+             info.rowCount <= info.columnBytes / (sizeof(float) + 4);
+        if (!ok) {
+            break;
+        }
+        blocks.push_back(info);
+        rowCount += info.rowCount;
+    }
+
+    if (!ok) {
+        std::cerr << "Error: Corrupt block index in " << path << std::endl;
+        blocks.clear();
+        rowCount = 0;
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<BlockLedgerFile::DecodedBlock> BlockLedgerFile::loadBlock(size_t index) const {
+    auto cached = cacheIndex.find(index);
+    if (cached != cacheIndex.end()) {
+        cacheOrder.splice(cacheOrder.begin(), cacheOrder, cached->second);
+        return cached->second->second;
+    }
+
+    const BlockInfo& info = blocks[index];
+    std::vector<uint8_t> bytes(info.columnBytes);
+    file.clear();
+    file.seekg(info.offset);
+    file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+    if (!file) {
+        std::cerr << "Error: Unable to read block " << index << " of " << path << std::endl;
+        return nullptr;
+    }
+    blocksRead++;
+
+    auto block = std::make_shared<DecodedBlock>();
+    const uint8_t* pos = bytes.data();
+    const uint8_t* end = pos + bytes.size();
+    bool ok = true;
+
+    block->amounts.resize(info.rowCount);
+    for (uint32_t i = 0; ok && i < info.rowCount; i++) {
+        ok = getRaw(pos, end, block->amounts[i]);
+    }
+
+    // Ids index the dictionaries directly, so each is checked against its size
+    std::vector<uint32_t>* columns[] = {&block->types, &block->categories, &block->currencies};
+    size_t dictionarySizes[] = {types.size(), categories.size(), currencies.size()};
+    for (size_t c = 0; c < 3; c++) {
+        columns[c]->resize(info.rowCount);
+        for (uint32_t i = 0; ok && i < info.rowCount; i++) {
+            uint64_t id = 0;
+            ok = getVarint(pos, end, id) && id < dictionarySizes[c];
+            (*columns[c])[i] = static_cast<uint32_t>(id);
+        }
+    }
+
+    block->dates.resize(info.rowCount);
+    uint64_t previous = 0;     // unsigned so corrupt deltas wrap instead of overflowing
+    for (uint32_t i = 0; ok && i < info.rowCount; i++) {
+        uint64_t zigzag = 0;
+        ok = getVarint(pos, end, zigzag);
+        previous += (zigzag >> 1) ^ (0 - (zigzag & 1));
+        block->dates[i] = static_cast<uint32_t>(previous);
+    }
+
+    if (!ok) {
+        std::cerr << "Error: Corrupt block " << index << " in " << path << std::endl;
+        return nullptr;
+    }
+
+    block->memoryUsage = sizeof(DecodedBlock) + info.rowCount * (sizeof(float) + 4 * sizeof(uint32_t));
+    cacheOrder.emplace_front(index, block);
+    cacheIndex[index] = cacheOrder.begin();
+    cacheBytes += block->memoryUsage;
+    trimCache();
+    return block;
+}
+
+bool BlockLedgerFile::loadDescriptions(size_t index, DecodedBlock& block) const {
+    const BlockInfo& info = blocks[index];
+    std::vector<uint8_t> compressed(info.descriptionBytes);
+    file.clear();
+    file.seekg(info.offset + info.columnBytes);
+    file.read(reinterpret_cast<char*>(compressed.data()), compressed.size());
+
+    std::string raw;
+    if (!file || !lzDecompress(compressed.data(), compressed.data() + compressed.size(),
+                               info.descriptionRawBytes, raw)) {
+        std::cerr << "Error: Corrupt descriptions in block " << index << " of " << path << std::endl;
+        return false;
+    }
+
+    const uint8_t* pos = reinterpret_cast<const uint8_t*>(raw.data());
+    const uint8_t* end = pos + raw.size();
+    block.descriptions.resize(info.rowCount);
+    for (uint32_t i = 0; i < info.rowCount; i++) {
+        if (!getString(pos, end, block.descriptions[i])) {
+            block.descriptions.clear();
+            return false;
+        }
+    }
+
+    size_t added = raw.size() + info.rowCount * sizeof(std::string);
+    block.memoryUsage += added;
+    if (cacheIndex.find(index) != cacheIndex.end()) {
+        cacheBytes += added;
+        trimCache();
+    }
+    return true;
+}
+
+// Drops least recently used blocks until the cache fits its budget. The
+// most recent block always stays so a single query can make progress.
+void BlockLedgerFile::trimCache() const {
+    while (cacheBytes > cacheBudget && cacheOrder.size() > 1) {
+        cacheBytes -= cacheOrder.back().second->memoryUsage;
+        cacheIndex.erase(cacheOrder.back().first);
+        cacheOrder.pop_back();
+    }
+}
+
+std::vector<Transaction> BlockLedgerFile::query(const BlockQuery& filter) const {
+    std::vector<Transaction> results;
+
+    auto lookup = [](const std::vector<std::string>& dictionary, const std::string& value) {
+        auto it = std::find(dictionary.begin(), dictionary.end(), value);
+        return static_cast<uint32_t>(it - dictionary.begin());
+    };
+
+    // A value missing from the dictionary can't match any row
+    uint32_t typeId = lookup(types, filter.type);
+    uint32_t categoryId = lookup(categories, filter.category);
+    uint32_t currencyId = lookup(currencies, filter.currency);
+    if ((!filter.type.empty() && typeId == types.size()) ||
+        (!filter.category.empty() && categoryId == categories.size()) ||
+        (!filter.currency.empty() && currencyId == currencies.size())) {
+        return results;
+    }
+
+    bool hasDates = !filter.fromDate.empty() || !filter.toDate.empty();
+    uint32_t fromDate = filter.fromDate.empty() ? 1 : dateToInt(filter.fromDate);
+    uint32_t toDate = filter.toDate.empty() ? UINT32_MAX : dateToInt(filter.toDate);
+    if (fromDate == 0 || toDate == 0) {
+        std::cerr << "Error: Invalid date, expected YYYY-MM-DD" << std::endl;
+        return results;
+    }
+    bool hasMax = filter.maxAmount >= 0.0f;
+
+    for (size_t b = 0; b < blocks.size(); b++) {
+        const BlockInfo& info = blocks[b];
+
+        // Zone maps: skip blocks whose ranges rule out every row
+        if (info.maxAmount < filter.minAmount || (hasMax && info.minAmount > filter.maxAmount)) {
+            continue;
+        }
+        if (hasDates && (info.maxDate == 0 || info.maxDate < fromDate || info.minDate > toDate)) {
+            continue;
+        }
+        if ((!filter.category.empty() && !testBit(info.categoryBits, categoryId)) ||
+            (!filter.currency.empty() && !testBit(info.currencyBits, currencyId))) {
+            continue;
+        }
+
+        std::shared_ptr<DecodedBlock> block = loadBlock(b);
+        if (!block) {
+            continue;
+        }
+
+        std::vector<uint32_t> matches;
+        for (uint32_t i = 0; i < info.rowCount; i++) {
+            float amount = block->amounts[i];
+            bool match = amount >= filter.minAmount && (!hasMax || amount <= filter.maxAmount) &&
+                         (!hasDates || (block->dates[i] >= fromDate && block->dates[i] <= toDate)) &&
+                         (filter.type.empty() || block->types[i] == typeId) &&
+                         (filter.category.empty() || block->categories[i] == categoryId) &&
+                         (filter.currency.empty() || block->currencies[i] == currencyId);
+            if (match) {
+                matches.push_back(i);
+            }
+        }
+
+        if (matches.empty()) {
+            continue;
+        }
+        if (block->descriptions.empty() && !loadDescriptions(b, *block)) {
+            continue;
+        }
+
+        for (uint32_t i : matches) {
+            results.emplace_back(block->descriptions[i], block->amounts[i], types[block->types[i]],
+                                 categories[block->categories[i]], currencies[block->currencies[i]],
+                                 intToDate(block->dates[i]));
+        }
+    }
+    return results;
+}
+
+uint64_t BlockLedgerFile::getRowCount() const {
+    return rowCount;
+}
+
+size_t BlockLedgerFile::getBlockCount() const {
+    return blocks.size();
+}
+
+size_t BlockLedgerFile::getBlocksRead() const {
+    return blocksRead;
+}
+
+size_t BlockLedgerFile::getCacheBytes() const {
+    return cacheBytes;
+}
@@ -0,0 +1,129 @@
+#ifndef BLOCK_LEDGER_HPP
+#define BLOCK_LEDGER_HPP
+
+#include <vector>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <fstream>
+#include <memory>
+#include <cstdint>
+#include "transaction.hpp"
+#include "string_interner.hpp"
+
+#define BLOCK_LEDGER_ROWS_PER_BLOCK 4096
+#define BLOCK_LEDGER_CACHE_BYTES (32u * 1024u * 1024u)
+
+// Filter for BlockLedgerFile::query(); empty strings match anything
+struct BlockQuery {
+    float minAmount = 0.0f;
+    float maxAmount = -1.0f;    // negative means no upper bound
+    std::string fromDate;       // YYYY-MM-DD, inclusive; undated rows never match a date range,
+                                // and a malformed date matches nothing
+    std::string toDate;
+    std::string type;
+    std::string category;
+    std::string currency;
+};
+
+// Read-only compressed ledger archive.
+//
+// Rows are stored in blocks of BLOCK_LEDGER_ROWS_PER_BLOCK. Inside a block
+// each column is stored separately: type, category and currency as ids into
+// file-wide dictionaries, dates as deltas, and descriptions compressed with
+// a small LZ77 codec. The footer keeps a zone map per block (min/max of
+// amount and date, and bitsets of the category and currency ids present)
+// so queries can skip blocks that cannot match without reading them.
+// Decoded blocks are kept in an LRU cache bounded by bytes, and descriptions
+// are only decompressed for blocks that have a matching row. Not thread
+// safe: queries share the cache and the file handle.
+class BlockLedgerFile {
+private:
+    friend class BlockLedgerWriter;
+
+    struct BlockInfo {
+        uint64_t offset;
+        uint32_t rowCount;
+        uint32_t columnBytes;
+        uint32_t descriptionBytes;      // compressed
+        uint32_t descriptionRawBytes;
+        float minAmount, maxAmount;
+        uint32_t minDate, maxDate;      // YYYYMMDD over dated rows, 0 if none
+        std::vector<uint8_t> categoryBits;  // bit i set if dictionary id i occurs
+        std::vector<uint8_t> currencyBits;
+    };
+
+    struct DecodedBlock {
+        std::vector<float> amounts;
+        std::vector<uint32_t> types, categories, currencies, dates;
+        std::vector<std::string> descriptions;  // empty until needed
+        size_t memoryUsage;
+    };
+
+    std::string path;
+    mutable std::ifstream file;
+    std::vector<std::string> types, categories, currencies;
+    std::vector<BlockInfo> blocks;
+    uint64_t rowCount;
+
+    // LRU block cache, most recently used at the front
+    size_t cacheBudget;
+    mutable size_t cacheBytes;
+    mutable std::list<std::pair<size_t, std::shared_ptr<DecodedBlock>>> cacheOrder;
+    mutable std::unordered_map<size_t, decltype(cacheOrder)::iterator> cacheIndex;
+    mutable size_t blocksRead;
+
+    std::shared_ptr<DecodedBlock> loadBlock(size_t index) const;
+    bool loadDescriptions(size_t index, DecodedBlock& block) const;
+    void trimCache() const;
+
+public:
+    explicit BlockLedgerFile(size_t cacheBytesLimit = BLOCK_LEDGER_CACHE_BYTES);
+
+    // Writes a whole in-memory ledger; see BlockLedgerWriter for streaming
+    static bool write(const std::string& file, const std::vector<Transaction>& rows,
+                      uint32_t rowsPerBlock = BLOCK_LEDGER_ROWS_PER_BLOCK);
+
+    // Converts a CSV ledger one row at a time, without loading it
+    static bool writeFromCSV(const std::string& csvFile, const std::string& file,
+                             uint32_t rowsPerBlock = BLOCK_LEDGER_ROWS_PER_BLOCK);
+
+    bool open(const std::string& file);
+
+    // Returns matching rows; blocks excluded by their zone maps are never read
+    std::vector<Transaction> query(const BlockQuery& filter) const;
+
+    static uint32_t dateToInt(const std::string& date);
+
+    // Getters
+    uint64_t getRowCount() const;
+    size_t getBlockCount() const;
+    size_t getBlocksRead() const;       // blocks decoded from disk since open()
+    size_t getCacheBytes() const;
+};
+
+// Streaming writer for BlockLedgerFile archives. Rows are buffered for one
+// block at a time and written out as soon as the block is full, so only the
+// dictionaries and the per-block zone maps are held until close().
+class BlockLedgerWriter {
+private:
+    std::ofstream out;
+    uint32_t rowsPerBlock;
+    uint64_t offset;
+    StringInterner typeIds, categoryIds, currencyIds;
+    std::vector<BlockLedgerFile::BlockInfo> infos;
+    std::vector<Transaction> pending;
+
+    void flushBlock();
+
+public:
+    explicit BlockLedgerWriter(uint32_t blockRows = BLOCK_LEDGER_ROWS_PER_BLOCK);
+
+    bool open(const std::string& file);
+    void append(const Transaction& row);
+    bool close();   // writes the footer; the archive is unreadable until then
+
+    ~BlockLedgerWriter();
+};
+
+#endif
@@ -0,0 +1,235 @@
+#include "budget_engine.hpp"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+static std::string trim(const std::string& text) {
+    size_t start = text.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) {
+        return "";
+    }
+    return text.substr(start, text.find_last_not_of(" \t\r\n") - start + 1);
+}
+
+void ConsoleAlertSink::onBreach(const BudgetAlert& alert) {
+    const BudgetRule& rule = *alert.rule;
+
+    std::cout << std::fixed << std::setprecision(2);
+    if (rule.kind == BudgetRule::CAP) {
+        std::cout << "Limit alert: '" << alert.transaction->getDescription() << "' "
+                  << alert.total << " " << alert.transaction->getCurrency()
+                  << " exceeds the cap of " << rule.limit
+                  << " (" << rule.category << ", " << rule.currency << ")" << std::endl;
+    } else {
+        std::cout << "Budget alert: spending on " << rule.category << " (" << rule.currency;
+        if (!alert.period.empty()) {
+            std::cout << ", " << alert.period;
+        }
+        std::cout << ") reached " << alert.total << ", over the budget of "
+                  << rule.limit << std::endl;
+    }
+}
+
+BudgetEngine::BudgetEngine(AlertSink* alertSink)
+    : currencySlots(1), spentStride(0), lastMonthId(StringInterner::NOT_FOUND), sink(alertSink), dirty(false) {
+    resetTotals();
+}
+
+void BudgetEngine::addRule(const BudgetRule& rule) {
+    rules.push_back(rule);
+    dirty = true;
+}
+
+// Format, one rule per line: kind,category,currency,period,limit
+//   budget,food,INR,month,5000
+//   cap,*,USD,,200
+bool BudgetEngine::loadRules(const std::string& file) {
+    std::ifstream in(file);
+    if (!in.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::stringstream ss(line);
+        std::string kind, category, currency, period, limit;
+        std::getline(ss, kind, ',');
+        std::getline(ss, category, ',');
+        std::getline(ss, currency, ',');
+        std::getline(ss, period, ',');
+        std::getline(ss, limit);
+
+        kind = trim(kind);
+        category = trim(category);
+        period = trim(period);
+        if (!period.empty() && period != "month") {
+            std::cerr << "Warning: Skipping budget rule with unknown period '" << line << "'" << std::endl;
+            continue;
+        }
+
+        // Transaction currencies are upper-cased when added, so match that
+        currency = trim(currency);
+        std::transform(currency.begin(), currency.end(), currency.begin(), ::toupper);
+
+        BudgetRule rule;
+        if (kind == "budget") {
+            rule.kind = BudgetRule::BUDGET;
+        } else if (kind == "cap") {
+            rule.kind = BudgetRule::CAP;
+        } else {
+            std::cerr << "Warning: Skipping unknown budget rule '" << line << "'" << std::endl;
+            continue;
+        }
+
+        try {
+            rule.limit = std::stof(limit);
+        } catch (...) {
+            std::cerr << "Warning: Skipping budget rule with invalid limit '" << line << "'" << std::endl;
+            continue;
+        }
+
+        rule.category = category.empty() ? RULE_ANY : category;
+        rule.currency = currency.empty() ? RULE_ANY : currency;
+        rule.monthly = (period == "month");
+        addRule(rule);
+    }
+    return true;
+}
+
+void BudgetEngine::clearRules() {
+    rules.clear();
+    resetTotals();
+    dirty = true;
+}
+
+void BudgetEngine::compile() {
+    compiled.clear();
+    ruleTable.clear();
+    categories.clear();
+    currencies.clear();
+
+    for (const auto& rule : rules) {
+        if (rule.category != RULE_ANY) {
+            categories.intern(rule.category);
+        }
+        if (rule.currency != RULE_ANY) {
+            currencies.intern(rule.currency);
+        }
+    }
+    uint32_t categorySlots = categories.size() + 1;
+    currencySlots = currencies.size() + 1;
+    ruleTable.resize(categorySlots * currencySlots);
+
+    for (uint32_t i = 0; i < rules.size(); i++) {
+        const BudgetRule& rule = rules[i];
+        compiled.push_back({rule.monthly, rule.limit});
+
+        uint32_t firstCategory = 0, lastCategory = categorySlots - 1;
+        if (rule.category != RULE_ANY) {
+            firstCategory = lastCategory = categories.find(rule.category);
+        }
+        uint32_t firstCurrency = 0, lastCurrency = currencySlots - 1;
+        if (rule.currency != RULE_ANY) {
+            firstCurrency = lastCurrency = currencies.find(rule.currency);
+        }
+
+        for (uint32_t category = firstCategory; category <= lastCategory; category++) {
+            for (uint32_t currency = firstCurrency; currency <= lastCurrency; currency++) {
+                RuleSlot& slot = ruleTable[category * currencySlots + currency];
+                (rule.kind == BudgetRule::CAP ? slot.caps : slot.budgets).push_back(i);
+            }
+        }
+    }
+
+    // Rules are only ever appended, so existing totals keep their rule index
+    if (spentStride != rules.size()) {
+        std::vector<double> resized(periods.size() * rules.size(), 0.0);
+        size_t kept = std::min(spentStride, rules.size());
+        for (size_t period = 0; spentStride > 0 && period < periods.size(); period++) {
+            std::copy(spent.begin() + period * spentStride, spent.begin() + period * spentStride + kept,
+                      resized.begin() + period * rules.size());
+        }
+        spent.swap(resized);
+        spentStride = rules.size();
+    }
+    dirty = false;
+}
+
+uint32_t BudgetEngine::monthId(const Transaction& transaction) {
+    std::string month = transaction.getMonth();
+    if (month != lastMonth || lastMonthId == StringInterner::NOT_FOUND) {
+        lastMonthId = periods.intern(month);
+        lastMonth = month;
+        if (spent.size() < periods.size() * spentStride) {
+            spent.resize(periods.size() * spentStride, 0.0);
+        }
+    }
+    return lastMonthId;
+}
+
+void BudgetEngine::evaluate(const Transaction& transaction) {
+    if (dirty) {
+        compile();
+    }
+    if (rules.empty()) {
+        return;
+    }
+
+    uint32_t categoryId = categories.find(transaction.getCategory());
+    if (categoryId == StringInterner::NOT_FOUND) {
+        categoryId = categories.size();
+    }
+    uint32_t currencyId = currencies.find(transaction.getCurrency());
+    if (currencyId == StringInterner::NOT_FOUND) {
+        currencyId = currencies.size();
+    }
+    const RuleSlot& slot = ruleTable[categoryId * currencySlots + currencyId];
+
+    float amount = transaction.getAmount();
+    for (uint32_t index : slot.caps) {
+        if (amount > compiled[index].limit && sink) {
+            sink->onBreach({&rules[index], &transaction, "", amount});
+        }
+    }
+
+    if (slot.budgets.empty() || transaction.getType() != "debit") {
+        return;
+    }
+
+    // The period is interned once per row, not once per rule
+    uint32_t month = monthId(transaction);
+    for (uint32_t index : slot.budgets) {
+        const CompiledRule& rule = compiled[index];
+        uint32_t period = rule.monthly ? month : 0;
+        double& total = spent[period * spentStride + index];
+        double before = total;
+        total += amount;
+
+        // Only report the crossing, not every transaction after it
+        if (before <= rule.limit && total > rule.limit && sink) {
+            sink->onBreach({&rules[index], &transaction, periods.getString(period), total});
+        }
+    }
+}
+
+void BudgetEngine::resetTotals() {
+    periods.clear();
+    periods.intern("");
+    spent.assign(spentStride, 0.0);
+    lastMonth.clear();
+    lastMonthId = StringInterner::NOT_FOUND;
+}
+
+int BudgetEngine::getRuleCount() const {
+    return rules.size();
+}
+
+const std::vector<BudgetRule>& BudgetEngine::getRules() const {
+    return rules;
+}
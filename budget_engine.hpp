@@ -0,0 +1,95 @@
+#ifndef BUDGET_ENGINE_HPP
+#define BUDGET_ENGINE_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "transaction.hpp"
+#include "string_interner.hpp"
+
+#define RULE_ANY "*"
+
+// A spending rule. category and currency may be RULE_ANY.
+struct BudgetRule {
+    enum Kind { BUDGET, CAP };
+
+    Kind kind;              // BUDGET: total debits per period, CAP: any single transaction
+    std::string category;
+    std::string currency;
+    bool monthly;           // BUDGET only: reset every calendar month
+    float limit;
+};
+
+// Emitted once when a budget is first exceeded, and for every capped transaction
+struct BudgetAlert {
+    const BudgetRule* rule;
+    const Transaction* transaction;
+    std::string period;     // YYYY-MM for monthly budgets, empty otherwise
+    double total;           // period total for budgets, the amount for caps
+};
+
+class AlertSink {
+public:
+    virtual void onBreach(const BudgetAlert& alert) = 0;
+    virtual ~AlertSink() {}
+};
+
+class ConsoleAlertSink : public AlertSink {
+public:
+    void onBreach(const BudgetAlert& alert) override;
+};
+
+// Evaluates budget rules against each transaction as it is ingested.
+// Rules are compiled into a table indexed by interned category and currency
+// id, so a transaction only looks at the rules that apply to it.
+class BudgetEngine {
+private:
+    // The fields evaluate() needs, kept small and contiguous
+    struct CompiledRule {
+        bool monthly;
+        float limit;
+    };
+
+    // Rule indices that apply to one (category, currency) pair
+    struct RuleSlot {
+        std::vector<uint32_t> caps;
+        std::vector<uint32_t> budgets;
+    };
+
+    std::vector<BudgetRule> rules;
+    std::vector<CompiledRule> compiled;
+    // [category slot * currency slots + currency slot]; the last slot of each
+    // is for values no rule names, which only wildcard rules match
+    std::vector<RuleSlot> ruleTable;
+    uint32_t currencySlots;
+    StringInterner categories;
+    StringInterner currencies;
+    StringInterner periods;             // id 0 is the all-time period ""
+    std::vector<double> spent;          // running totals, [period * rule count + rule]
+    size_t spentStride;                 // rule count the spent table is laid out for
+    std::string lastMonth;              // rows usually arrive month by month
+    uint32_t lastMonthId;
+    AlertSink* sink;
+    bool dirty;
+
+    void compile();
+    uint32_t monthId(const Transaction& transaction);
+
+public:
+    explicit BudgetEngine(AlertSink* alertSink);
+
+    // Rule setup
+    void addRule(const BudgetRule& rule);
+    bool loadRules(const std::string& file);
+    void clearRules();
+
+    // Ingest
+    void evaluate(const Transaction& transaction);
+    void resetTotals();
+
+    // Getters
+    int getRuleCount() const;
+    const std::vector<BudgetRule>& getRules() const;
+};
+
+#endif
@@ -49,11 +49,27 @@ if defined CURL_INCLUDE (
     g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c transaction.cpp -o transaction.o
     g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c transaction_manager.cpp -o transaction_manager.o
     g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c currency_converter.cpp -o currency_converter.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c work_scheduler.cpp -o work_scheduler.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c ledger_registry.cpp -o ledger_registry.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c description_index.cpp -o description_index.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c string_interner.cpp -o string_interner.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c budget_engine.cpp -o budget_engine.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c block_ledger.cpp -o block_ledger.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c group_by.cpp -o group_by.o
+    g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c ledger_sketches.cpp -o ledger_sketches.o
     g++ -std=c++17 -Wall -Wextra -I"%CURL_INCLUDE%" -c main.cpp -o main.o
 ) else (
     g++ -std=c++17 -Wall -Wextra -c transaction.cpp -o transaction.o
     g++ -std=c++17 -Wall -Wextra -c transaction_manager.cpp -o transaction_manager.o
     g++ -std=c++17 -Wall -Wextra -c currency_converter.cpp -o currency_converter.o
+    g++ -std=c++17 -Wall -Wextra -c work_scheduler.cpp -o work_scheduler.o
+    g++ -std=c++17 -Wall -Wextra -c ledger_registry.cpp -o ledger_registry.o
+    g++ -std=c++17 -Wall -Wextra -c description_index.cpp -o description_index.o
+    g++ -std=c++17 -Wall -Wextra -c string_interner.cpp -o string_interner.o
+    g++ -std=c++17 -Wall -Wextra -c budget_engine.cpp -o budget_engine.o
+    g++ -std=c++17 -Wall -Wextra -c block_ledger.cpp -o block_ledger.o
+    g++ -std=c++17 -Wall -Wextra -c group_by.cpp -o group_by.o
+    g++ -std=c++17 -Wall -Wextra -c ledger_sketches.cpp -o ledger_sketches.o
     g++ -std=c++17 -Wall -Wextra -c main.cpp -o main.o
 )
 
@@ -65,9 +81,9 @@ if %errorLevel% neq 0 (
 
 echo Linking...
 if defined CURL_LIB (
-    g++ transaction.o transaction_manager.o currency_converter.o main.o -L"%CURL_LIB%" -lcurl -lws2_32 -o monefy.exe
+    g++ transaction.o transaction_manager.o currency_converter.o work_scheduler.o ledger_registry.o description_index.o string_interner.o budget_engine.o block_ledger.o group_by.o ledger_sketches.o main.o -L"%CURL_LIB%" -lcurl -lws2_32 -pthread -o monefy.exe
 ) else (
-    g++ transaction.o transaction_manager.o currency_converter.o main.o -lcurl -lws2_32 -o monefy.exe
+    g++ transaction.o transaction_manager.o currency_converter.o work_scheduler.o ledger_registry.o description_index.o string_interner.o budget_engine.o block_ledger.o group_by.o ledger_sketches.o main.o -lcurl -lws2_32 -pthread -o monefy.exe
 )
 
 if %errorLevel% neq 0 (
@@ -35,7 +35,7 @@ if (Get-Command g++ -ErrorAction SilentlyContinue) {
     Write-Host "Compiling source files..." -ForegroundColor Cyan
 
     # Compile source files
-    $sourceFiles = @("transaction.cpp", "transaction_manager.cpp", "currency_converter.cpp", "main.cpp")
+    $sourceFiles = @("transaction.cpp", "transaction_manager.cpp", "currency_converter.cpp", "work_scheduler.cpp", "ledger_registry.cpp", "description_index.cpp", "string_interner.cpp", "budget_engine.cpp", "block_ledger.cpp", "group_by.cpp", "ledger_sketches.cpp", "main.cpp")
 
     foreach ($file in $sourceFiles) {
         if ($curlInclude) {
@@ -56,10 +56,10 @@ if (Get-Command g++ -ErrorAction SilentlyContinue) {
 
     # Link
     if ($curlLib) {
-        & g++ transaction.o transaction_manager.o currency_converter.o main.o -L"$curlLib" -lcurl -lws2_32 -o monefy.exe
+        & g++ transaction.o transaction_manager.o currency_converter.o work_scheduler.o ledger_registry.o description_index.o string_interner.o budget_engine.o block_ledger.o group_by.o ledger_sketches.o main.o -L"$curlLib" -lcurl -lws2_32 -pthread -o monefy.exe
     }
     else {
-        & g++ transaction.o transaction_manager.o currency_converter.o main.o -lcurl -lws2_32 -o monefy.exe
+        & g++ transaction.o transaction_manager.o currency_converter.o work_scheduler.o ledger_registry.o description_index.o string_interner.o budget_engine.o block_ledger.o group_by.o ledger_sketches.o main.o -lcurl -lws2_32 -pthread -o monefy.exe
     }
 
     if ($LASTEXITCODE -ne 0) {
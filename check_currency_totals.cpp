@@ -0,0 +1,97 @@
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include "transaction_manager.hpp"
+#include "currency_converter.hpp"
+
+// Checks that the bucketed per-currency totals match converting every
+// transaction on its own. Runs offline against a fixed rate table.
+
+// Reference path: converts every row
+static void convertedTotalsPerRow(const TransactionManager& manager, CurrencyConverter& converter,
+                                  const std::string& targetCurrency, const std::string& category,
+                                  double& credit, double& debit) {
+    credit = 0.0;
+    debit = 0.0;
+
+    for (const auto& transaction : manager.getTransactions()) {
+        if (!category.empty() && transaction.getCategory() != category) {
+            continue;
+        }
+
+        double convertedAmount = converter.convertCurrency(
+            static_cast<double>(transaction.getAmount()),
+            transaction.getCurrency(),
+            targetCurrency
+        );
+
+        if (transaction.getType() == "credit") {
+            credit += convertedAmount;
+        } else if (transaction.getType() == "debit") {
+            debit += convertedAmount;
+        }
+    }
+}
+
+// Both sides work in double, so only the order of additions differs
+static bool closeEnough(double expected, double actual) {
+    return std::fabs(expected - actual) <= 1e-9 * std::fabs(expected) + 1e-6;
+}
+
+int main() {
+    std::string file = (std::filesystem::temp_directory_path() / "monefy_check_currency_totals.csv").string();
+
+    const char* currencies[] = { "INR", "USD", "EUR", "GBP" };
+    const char* categories[] = { "food", "rent", "salary", "travel" };
+    {
+        std::ofstream out(file);
+        if (!out.is_open()) {
+            std::cerr << "Error: Unable to create " << file << std::endl;
+            return 1;
+        }
+        for (int i = 0; i < 500; i++) {
+            out << "row " << i << "," << (i % 97) * 3.25f + 0.5f << ","
+                << (i % 3 == 0 ? "credit" : "debit") << "," << categories[i % 4] << ","
+                << currencies[(i / 4) % 4] << ",2026-01-" << (i % 28) + 10 << std::endl;
+        }
+    }
+
+    CurrencyConverter converter("");
+    converter.setExchangeRates("INR", { { "INR", 1.0f }, { "USD", 0.012f }, { "EUR", 0.011f }, { "GBP", 0.0095f } });
+
+    int failures = 0;
+    {
+        TransactionManager manager(file, &converter);
+
+        for (const char* target : currencies) {
+            for (const std::string category : { "", "food", "salary" }) {
+                double credit, debit, rowCredit, rowDebit;
+                manager.getConvertedTotals(target, credit, debit, category);
+                convertedTotalsPerRow(manager, converter, target, category, rowCredit, rowDebit);
+
+                if (!closeEnough(rowCredit, credit) || !closeEnough(rowDebit, debit)) {
+                    std::cerr << std::fixed << std::setprecision(6)
+                              << "Mismatch in " << target << " (category '" << category << "'): "
+                              << credit << "/" << debit << " vs per-row "
+                              << rowCredit << "/" << rowDebit << std::endl;
+                    failures++;
+                }
+            }
+        }
+    }
+
+    std::remove(file.c_str());
+    std::remove((file + SKETCH_FILE_SUFFIX).c_str());
+
+    if (failures > 0) {
+        std::cerr << failures << " currency total checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "Currency totals match per-transaction conversion" << std::endl;
+    return 0;
+}
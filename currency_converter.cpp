@@ -54,6 +54,12 @@ bool CurrencyConverter::fetchExchangeRates(const std::string& baseCurrency) {
     return parseExchangeRates(readBuffer);
 }
 
+void CurrencyConverter::setExchangeRates(const std::string& baseCurrency,
+                                         const std::map<std::string, float>& rates) {
+    this->baseCurrency = baseCurrency;
+    exchangeRates = rates;
+}
+
 // Simple JSON parser for extracting rates
 bool CurrencyConverter::parseExchangeRates(const std::string& jsonResponse) {
     try {
@@ -130,6 +136,11 @@ bool CurrencyConverter::parseExchangeRates(const std::string& jsonResponse) {
 
 float CurrencyConverter::convertCurrency(float amount, const std::string& fromCurrency, 
                                         const std::string& toCurrency) {
+    return static_cast<float>(convertCurrency(static_cast<double>(amount), fromCurrency, toCurrency));
+}
+
+double CurrencyConverter::convertCurrency(double amount, const std::string& fromCurrency,
+                                         const std::string& toCurrency) {
     if (fromCurrency == toCurrency) {
         return amount;
     }
@@ -150,13 +161,13 @@ float CurrencyConverter::convertCurrency(float amount, const std::string& fromCu
     else {
         if (exchangeRates.find(fromCurrency) != exchangeRates.end() &&
             exchangeRates.find(toCurrency) != exchangeRates.end()) {
-            float toBase = amount / exchangeRates[fromCurrency];
+            double toBase = amount / exchangeRates[fromCurrency];
             return toBase * exchangeRates[toCurrency];
         }
     }
 
     std::cerr << "Error: Currency conversion failed. Unsupported currency." << std::endl;
-    return 0.0f;
+    return 0.0;
 }
 
 float CurrencyConverter::getExchangeRate(const std::string& targetCurrency) {
@@ -23,10 +23,15 @@ public:
     
     // Set base currency and fetch rates
     bool fetchExchangeRates(const std::string& baseCurrency);
+
+    // Use a known rate table instead of fetching one (offline use and checks)
+    void setExchangeRates(const std::string& baseCurrency, const std::map<std::string, float>& rates);
     
     // Convert amount from one currency to another
     float convertCurrency(float amount, const std::string& fromCurrency, 
                          const std::string& toCurrency);
+    double convertCurrency(double amount, const std::string& fromCurrency,
+                           const std::string& toCurrency);     // for large totals
     
     // Get exchange rate
     float getExchangeRate(const std::string& targetCurrency);
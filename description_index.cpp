@@ -0,0 +1,149 @@
+#include "description_index.hpp"
+#include <algorithm>
+#include <cctype>
+
+// Marks the start of a description so "^ub" style prefix trigrams exist
+static const char START_MARKER = '\x02';
+
+DescriptionIndex::DescriptionIndex() : rowCount(0) {}
+
+std::string DescriptionIndex::toLower(const std::string& text) {
+    std::string lower(text);
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower;
+}
+
+// Unique, sorted trigram keys of already lowercased text
+std::vector<uint32_t> DescriptionIndex::trigramsOf(const std::string& text) {
+    std::vector<uint32_t> grams;
+    if (text.size() < 3) {
+        return grams;
+    }
+
+    grams.reserve(text.size() - 2);
+    for (size_t i = 0; i + 2 < text.size(); i++) {
+        grams.push_back((static_cast<uint32_t>(static_cast<unsigned char>(text[i])) << 16) |
+                        (static_cast<uint32_t>(static_cast<unsigned char>(text[i + 1])) << 8) |
+                        static_cast<uint32_t>(static_cast<unsigned char>(text[i + 2])));
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+void DescriptionIndex::append(PostingList& list, uint32_t row) {
+    uint32_t gap = (list.count == 0) ? row : row - list.lastRow;
+    while (gap >= 0x80) {
+        list.bytes.push_back(static_cast<uint8_t>(gap | 0x80));
+        gap >>= 7;
+    }
+    list.bytes.push_back(static_cast<uint8_t>(gap));
+    list.lastRow = row;
+    list.count++;
+}
+
+std::vector<uint32_t> DescriptionIndex::decode(const PostingList& list) {
+    std::vector<uint32_t> rows;
+    rows.reserve(list.count);
+
+    uint32_t row = 0;
+    size_t pos = 0;
+    while (pos < list.bytes.size()) {
+        uint32_t gap = 0;
+        int shift = 0;
+        while (list.bytes[pos] & 0x80) {
+            gap |= static_cast<uint32_t>(list.bytes[pos++] & 0x7F) << shift;
+            shift += 7;
+        }
+        gap |= static_cast<uint32_t>(list.bytes[pos++]) << shift;
+        row += gap;
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+// Keeps only the rows that also appear in 'list', decoding it on the fly
+void DescriptionIndex::intersect(std::vector<uint32_t>& rows, const PostingList& list) {
+    size_t out = 0, next = 0;
+    uint32_t row = 0;
+    size_t pos = 0;
+
+    while (pos < list.bytes.size() && next < rows.size()) {
+        uint32_t gap = 0;
+        int shift = 0;
+        while (list.bytes[pos] & 0x80) {
+            gap |= static_cast<uint32_t>(list.bytes[pos++] & 0x7F) << shift;
+            shift += 7;
+        }
+        gap |= static_cast<uint32_t>(list.bytes[pos++]) << shift;
+        row += gap;
+
+        while (next < rows.size() && rows[next] < row) {
+            next++;
+        }
+        if (next < rows.size() && rows[next] == row) {
+            rows[out++] = row;
+            next++;
+        }
+    }
+    rows.resize(out);
+}
+
+void DescriptionIndex::addRow(const std::string& description) {
+    for (uint32_t gram : trigramsOf(START_MARKER + toLower(description))) {
+        append(postings[gram], rowCount);
+    }
+    rowCount++;
+}
+
+void DescriptionIndex::clear() {
+    postings.clear();
+    rowCount = 0;
+}
+
+bool DescriptionIndex::findCandidates(const std::string& query, bool prefix,
+                                      std::vector<uint32_t>& rows) const {
+    rows.clear();
+
+    std::string text = toLower(query);
+    if (prefix) {
+        text = START_MARKER + text;
+    }
+
+    std::vector<uint32_t> grams = trigramsOf(text);
+    if (grams.empty()) {
+        return false;
+    }
+
+    std::vector<const PostingList*> lists;
+    for (uint32_t gram : grams) {
+        auto it = postings.find(gram);
+        if (it == postings.end()) {
+            return true;   // some trigram never occurs: no matches
+        }
+        lists.push_back(&it->second);
+    }
+
+    // Start from the rarest trigram so the candidate set is small from the outset
+    std::sort(lists.begin(), lists.end(),
+              [](const PostingList* a, const PostingList* b) { return a->count < b->count; });
+
+    rows = decode(*lists[0]);
+    for (size_t i = 1; i < lists.size() && !rows.empty(); i++) {
+        intersect(rows, *lists[i]);
+    }
+    return true;
+}
+
+uint32_t DescriptionIndex::getRowCount() const {
+    return rowCount;
+}
+
+size_t DescriptionIndex::getMemoryUsage() const {
+    size_t bytes = sizeof(*this);
+    for (const auto& [gram, list] : postings) {
+        bytes += sizeof(gram) + sizeof(list) + list.bytes.capacity();
+    }
+    return bytes;
+}
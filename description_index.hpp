@@ -0,0 +1,49 @@
+#ifndef DESCRIPTION_INDEX_HPP
+#define DESCRIPTION_INDEX_HPP
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+// Case-insensitive trigram index over transaction descriptions.
+// Rows are appended with increasing ids, so each posting list is stored as
+// varint-encoded gaps between row ids. A start-of-text marker is indexed
+// too, which lets prefix queries use the index as well as substring ones.
+class DescriptionIndex {
+private:
+    struct PostingList {
+        std::vector<uint8_t> bytes;   // varint row id gaps
+        uint32_t lastRow;
+        uint32_t count;
+    };
+
+    std::unordered_map<uint32_t, PostingList> postings;
+    uint32_t rowCount;
+
+    static std::vector<uint32_t> trigramsOf(const std::string& text);
+    static void append(PostingList& list, uint32_t row);
+    static std::vector<uint32_t> decode(const PostingList& list);
+    static void intersect(std::vector<uint32_t>& rows, const PostingList& list);
+
+public:
+    DescriptionIndex();
+
+    // Rows must be added in order: 0, 1, 2, ...
+    void addRow(const std::string& description);
+    void clear();
+
+    // Fills 'rows' with candidate row ids (ascending) that contain every
+    // trigram of the query. Candidates still need to be verified against the
+    // text. Returns false if the query is too short to use the index, in
+    // which case every row is a candidate.
+    bool findCandidates(const std::string& query, bool prefix, std::vector<uint32_t>& rows) const;
+
+    static std::string toLower(const std::string& text);
+
+    // Getters
+    uint32_t getRowCount() const;
+    size_t getMemoryUsage() const;
+};
+
+#endif
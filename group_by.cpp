@@ -0,0 +1,296 @@
+#include "group_by.hpp"
+#include "string_interner.hpp"
+#include "work_scheduler.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <tuple>
+
+// Rows per scheduler task
+#define GROUP_BY_CHUNK_ROWS 16384
+
+namespace {
+
+enum { KEY_CATEGORY, KEY_TYPE, KEY_CURRENCY, KEY_MONTH, KEY_PARTS };
+
+struct GroupKey {
+    uint32_t ids[KEY_PARTS];
+
+    bool operator==(const GroupKey& other) const {
+        return std::equal(ids, ids + KEY_PARTS, other.ids);
+    }
+};
+
+struct Aggregate {
+    double sum;
+    uint64_t count;
+    float min;
+    float max;
+};
+
+// Open-addressing (linear probing) hash table from GroupKey to Aggregate
+class AggregateTable {
+public:
+    struct Slot {
+        GroupKey key;
+        Aggregate value;
+        bool used;
+    };
+
+private:
+    std::vector<Slot> slots;
+    size_t count;
+
+    static size_t hash(const GroupKey& key) {
+        uint64_t h = 0;
+        for (uint32_t id : key.ids) {
+            h = (h ^ id) * 0x9E3779B97F4A7C15ull;
+        }
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+
+    void grow() {
+        std::vector<Slot> old(slots.size() * 2);
+        old.swap(slots);
+        count = 0;
+        for (const auto& slot : old) {
+            if (slot.used) {
+                find(slot.key) = slot.value;
+            }
+        }
+    }
+
+public:
+    AggregateTable() : slots(64), count(0) {}
+
+    // Returns the aggregate for 'key', inserting an empty one if needed
+    Aggregate& find(const GroupKey& key) {
+        if ((count + 1) * 10 > slots.size() * 7) {
+            grow();
+        }
+
+        size_t mask = slots.size() - 1;
+        size_t pos = hash(key) & mask;
+        while (slots[pos].used && !(slots[pos].key == key)) {
+            pos = (pos + 1) & mask;
+        }
+
+        Slot& slot = slots[pos];
+        if (!slot.used) {
+            slot.used = true;
+            slot.key = key;
+            slot.value = {0.0, 0, 0.0f, 0.0f};
+            count++;
+        }
+        return slot.value;
+    }
+
+    const std::vector<Slot>& getSlots() const {
+        return slots;
+    }
+};
+
+void accumulate(Aggregate& into, const Aggregate& from) {
+    if (into.count == 0) {
+        into = from;
+        return;
+    }
+    into.sum += from.sum;
+    into.count += from.count;
+    into.min = std::min(into.min, from.min);
+    into.max = std::max(into.max, from.max);
+}
+
+// Output columns for the grouped dimensions
+struct Column {
+    unsigned dimension;
+    const char* header;     // CSV
+    const char* title;      // console
+    int width;
+    std::string GroupResult::*field;
+};
+
+const Column COLUMNS[] = {
+    {GROUP_CATEGORY, "category", "Category", 16, &GroupResult::category},
+    {GROUP_TYPE, "type", "Type", 8, &GroupResult::type},
+    {GROUP_CURRENCY, "currency", "Currency", 10, &GroupResult::currency},
+    {GROUP_MONTH, "month", "Month", 10, &GroupResult::month},
+};
+
+// Per-worker state: ids are only meaningful within one partial table
+struct PartialTable {
+    StringInterner dictionaries[KEY_PARTS];
+    AggregateTable table;
+};
+
+}
+
+double GroupResult::average() const {
+    return count ? sum / count : 0.0;
+}
+
+GroupByEngine::GroupByEngine(unsigned dims, unsigned threadCount)
+    : dimensions(dims), threads(threadCount) {}
+
+std::vector<GroupResult> GroupByEngine::run(const std::vector<Transaction>& rows) const {
+    WorkScheduler scheduler(threads);
+    std::vector<PartialTable> partials(scheduler.getWorkerCount());
+    size_t chunks = (rows.size() + GROUP_BY_CHUNK_ROWS - 1) / GROUP_BY_CHUNK_ROWS;
+
+    scheduler.run(chunks, [&](size_t chunk, unsigned worker) {
+        PartialTable& partial = partials[worker];
+        size_t end = std::min(rows.size(), (chunk + 1) * GROUP_BY_CHUNK_ROWS);
+
+        for (size_t i = chunk * GROUP_BY_CHUNK_ROWS; i < end; i++) {
+            const Transaction& row = rows[i];
+            GroupKey key = {{0, 0, 0, 0}};
+            if (dimensions & GROUP_CATEGORY) {
+                key.ids[KEY_CATEGORY] = partial.dictionaries[KEY_CATEGORY].intern(row.getCategory());
+            }
+            if (dimensions & GROUP_TYPE) {
+                key.ids[KEY_TYPE] = partial.dictionaries[KEY_TYPE].intern(row.getType());
+            }
+            if (dimensions & GROUP_CURRENCY) {
+                key.ids[KEY_CURRENCY] = partial.dictionaries[KEY_CURRENCY].intern(row.getCurrency());
+            }
+            if (dimensions & GROUP_MONTH) {
+                key.ids[KEY_MONTH] = partial.dictionaries[KEY_MONTH].intern(row.getMonth());
+            }
+
+            float amount = row.getAmount();
+            accumulate(partial.table.find(key), {amount, 1, amount, amount});
+        }
+    });
+
+    // Merge: translate each worker's local ids into shared ones
+    StringInterner dictionaries[KEY_PARTS];
+    AggregateTable merged;
+    for (const auto& partial : partials) {
+        for (const auto& slot : partial.table.getSlots()) {
+            if (!slot.used) {
+                continue;
+            }
+
+            GroupKey key = {{0, 0, 0, 0}};
+            for (int part = 0; part < KEY_PARTS; part++) {
+                if (partial.dictionaries[part].size() > 0) {
+                    key.ids[part] = dictionaries[part].intern(
+                        partial.dictionaries[part].getString(slot.key.ids[part]));
+                }
+            }
+            accumulate(merged.find(key), slot.value);
+        }
+    }
+
+    std::vector<GroupResult> groups;
+    for (const auto& slot : merged.getSlots()) {
+        if (!slot.used) {
+            continue;
+        }
+
+        GroupResult group;
+        std::string* fields[KEY_PARTS] = {&group.category, &group.type, &group.currency, &group.month};
+        for (int part = 0; part < KEY_PARTS; part++) {
+            if (dictionaries[part].size() > 0) {
+                *fields[part] = dictionaries[part].getString(slot.key.ids[part]);
+            }
+        }
+        group.sum = slot.value.sum;
+        group.count = slot.value.count;
+        group.min = slot.value.min;
+        group.max = slot.value.max;
+        groups.push_back(group);
+    }
+
+    std::sort(groups.begin(), groups.end(), [](const GroupResult& a, const GroupResult& b) {
+        return std::tie(a.category, a.type, a.currency, a.month) <
+               std::tie(b.category, b.type, b.currency, b.month);
+    });
+    return groups;
+}
+
+void GroupByEngine::display(const std::vector<GroupResult>& groups) const {
+    if (groups.empty()) {
+        std::cout << "No transactions to group." << std::endl;
+        return;
+    }
+
+    std::cout << std::endl;
+    std::cout << "================================================" << std::endl;
+    std::cout << std::left;
+    for (const auto& column : COLUMNS) {
+        if (dimensions & column.dimension) {
+            std::cout << std::setw(column.width) << column.title;
+        }
+    }
+    std::cout << std::right << std::setw(8) << "Count" << std::setw(14) << "Sum"
+              << std::setw(12) << "Avg" << std::setw(12) << "Min" << std::setw(12) << "Max" << std::endl;
+    std::cout << "================================================" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto& group : groups) {
+        std::cout << std::left;
+        for (const auto& column : COLUMNS) {
+            if (dimensions & column.dimension) {
+                const std::string& value = group.*column.field;
+                std::cout << std::setw(column.width) << (value.empty() ? "-" : value);
+            }
+        }
+        std::cout << std::right << std::setw(8) << group.count << std::setw(14) << group.sum
+                  << std::setw(12) << group.average() << std::setw(12) << group.min
+                  << std::setw(12) << group.max << std::endl;
+    }
+    std::cout << std::left;
+    std::cout << "================================================" << std::endl;
+    std::cout << std::endl;
+}
+
+bool GroupByEngine::exportCSV(const std::string& file, const std::vector<GroupResult>& groups) const {
+    std::ofstream out(file);
+    if (!out.is_open()) {
+        std::cerr << "Error: Unable to open " << file << " for writing" << std::endl;
+        return false;
+    }
+
+    for (const auto& column : COLUMNS) {
+        if (dimensions & column.dimension) {
+            out << column.header << ",";
+        }
+    }
+    out << "count,sum,avg,min,max" << std::endl;
+
+    out << std::fixed << std::setprecision(2);
+    for (const auto& group : groups) {
+        for (const auto& column : COLUMNS) {
+            if (dimensions & column.dimension) {
+                out << group.*column.field << ",";
+            }
+        }
+        out << group.count << "," << group.sum << "," << group.average() << ","
+            << group.min << "," << group.max << std::endl;
+    }
+    return true;
+}
+
+unsigned GroupByEngine::parseDimensions(const std::string& spec) {
+    unsigned dims = 0;
+    for (char c : spec) {
+        switch (std::tolower(static_cast<unsigned char>(c))) {
+            case 'c':
+                dims |= GROUP_CATEGORY;
+                break;
+            case 't':
+                dims |= GROUP_TYPE;
+                break;
+            case 'u':
+                dims |= GROUP_CURRENCY;
+                break;
+            case 'm':
+                dims |= GROUP_MONTH;
+                break;
+        }
+    }
+    return dims;
+}
@@ -0,0 +1,52 @@
+#ifndef GROUP_BY_HPP
+#define GROUP_BY_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "transaction.hpp"
+
+// Group-by dimensions, combined as a bitmask
+#define GROUP_CATEGORY 1u
+#define GROUP_TYPE     2u
+#define GROUP_CURRENCY 4u
+#define GROUP_MONTH    8u
+
+// One output group; dimensions that were not grouped on are left empty
+struct GroupResult {
+    std::string category;
+    std::string type;
+    std::string currency;
+    std::string month;
+    double sum;
+    uint64_t count;
+    float min;
+    float max;
+
+    double average() const;
+};
+
+// Hash aggregation over any combination of the dimensions above.
+// Rows are split into chunks that workers aggregate into their own
+// open-addressing tables keyed by locally interned ids; the partial tables
+// are merged once all chunks are done, so workers never share state.
+class GroupByEngine {
+private:
+    unsigned dimensions;
+    unsigned threads;
+
+public:
+    explicit GroupByEngine(unsigned dims, unsigned threadCount = 0);
+
+    // Groups sorted by key
+    std::vector<GroupResult> run(const std::vector<Transaction>& rows) const;
+
+    // Output
+    void display(const std::vector<GroupResult>& groups) const;
+    bool exportCSV(const std::string& file, const std::vector<GroupResult>& groups) const;
+
+    // Parses e.g. "cm" (category + month); returns 0 if nothing valid was given
+    static unsigned parseDimensions(const std::string& spec);
+};
+
+#endif
@@ -0,0 +1,209 @@
+#include "ledger_registry.hpp"
+#include "work_scheduler.hpp"
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+LedgerRegistry::LedgerRegistry(CurrencyConverter* curr, size_t budgetBytes)
+    : converter(curr), memoryBudget(budgetBytes), residentMemory(0), useClock(0) {}
+
+bool LedgerRegistry::openLedger(const std::string& name, const std::string& file) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (shardIndex.find(name) != shardIndex.end()) {
+        return false;
+    }
+
+    shardIndex[name] = shards.size();
+    shards.push_back({name, file, nullptr, 0, 0});
+    return true;
+}
+
+int LedgerRegistry::openDirectory(const std::string& directory) {
+    namespace fs = std::filesystem;
+
+    std::error_code ec;
+    if (!fs::is_directory(directory, ec)) {
+        return 0;
+    }
+
+    int opened = 0;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".csv") {
+            if (openLedger(entry.path().stem().string(), entry.path().string())) {
+                opened++;
+            }
+        }
+    }
+    return opened;
+}
+
+std::shared_ptr<TransactionManager> LedgerRegistry::acquire(size_t index) {
+    std::string filename;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Shard& shard = shards[index];
+        if (shard.manager) {
+            shard.lastUsed = ++useClock;
+            return shard.manager;
+        }
+        filename = shard.filename;
+    }
+
+    // Load outside the lock so several shards can be read from disk at once
+    auto manager = std::make_shared<TransactionManager>(filename, converter);
+    size_t usage = manager->getMemoryUsage();
+
+    // Evicted ledgers are released after unlocking: destroying one may save it to disk
+    std::vector<std::shared_ptr<TransactionManager>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Shard& shard = shards[index];
+        if (shard.manager) {
+            // Another thread loaded it first; use theirs
+            shard.lastUsed = ++useClock;
+            return shard.manager;
+        }
+
+        shard.manager = manager;
+        shard.memoryUsage = usage;
+        shard.lastUsed = ++useClock;
+        residentMemory += usage;
+        evictOverBudget(index, evicted);
+    }
+    evicted.clear();
+    return manager;
+}
+
+// Caller holds the mutex. Unloads least recently used shards (never 'keep')
+// until resident memory fits the budget, handing them to 'evicted' so the
+// caller can release them once the mutex is unlocked.
+void LedgerRegistry::evictOverBudget(size_t keep, std::vector<std::shared_ptr<TransactionManager>>& evicted) {
+    while (residentMemory > memoryBudget) {
+        size_t victim = shards.size();
+        for (size_t i = 0; i < shards.size(); i++) {
+            if (i == keep || !shards[i].manager) {
+                continue;
+            }
+            if (victim == shards.size() || shards[i].lastUsed < shards[victim].lastUsed) {
+                victim = i;
+            }
+        }
+        if (victim == shards.size()) {
+            return;
+        }
+
+        residentMemory -= shards[victim].memoryUsage;
+        shards[victim].memoryUsage = 0;
+        evicted.push_back(std::move(shards[victim].manager));
+    }
+}
+
+std::shared_ptr<TransactionManager> LedgerRegistry::getLedger(const std::string& name) {
+    size_t index;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = shardIndex.find(name);
+        if (it == shardIndex.end()) {
+            return nullptr;
+        }
+        index = it->second;
+    }
+    return acquire(index);
+}
+
+std::vector<LedgerSummary> LedgerRegistry::summarizeAll(const std::string& currency, unsigned threads,
+                                                       LedgerSketches* sketches) {
+    std::vector<std::string> names = getLedgerNames();
+
+    std::vector<LedgerSummary> summaries(names.size());
+    WorkScheduler scheduler(threads);
+    // Sketches are merged per worker first, then across workers
+    std::vector<LedgerSketches> partials(sketches ? scheduler.getWorkerCount() : 0);
+    scheduler.run(names.size(), [&](size_t index, unsigned worker) {
+        std::shared_ptr<TransactionManager> manager = acquire(index);
+
+        LedgerSummary& summary = summaries[index];
+        summary.name = names[index];
+        summary.transactionCount = manager->getTransactionCount();
+        summary.currency = currency;
+        manager->getConvertedTotals(currency, summary.totalCredit, summary.totalDebit);
+        if (sketches) {
+            partials[worker].merge(manager->getSketches());
+        }
+    });
+
+    for (const auto& partial : partials) {
+        sketches->merge(partial);
+    }
+    return summaries;
+}
+
+void LedgerRegistry::displayConsolidatedReport(const std::string& currency, unsigned threads) {
+    if (getLedgerCount() == 0) {
+        std::cout << "No ledgers registered." << std::endl;
+        return;
+    }
+
+    LedgerSketches sketches;
+    std::vector<LedgerSummary> summaries = summarizeAll(currency, threads, &sketches);
+
+    double totalCredit = 0.0, totalDebit = 0.0;
+    int totalCount = 0;
+
+    std::cout << std::endl;
+    std::cout << "================================================" << std::endl;
+    std::cout << "Consolidated Report (" << summaries.size() << " ledgers, in " << currency << "):" << std::endl;
+    std::cout << "================================================" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (const auto& summary : summaries) {
+        std::cout << summary.name << ": " << summary.transactionCount << " transactions, "
+                  << "credit " << summary.totalCredit << ", debit " << summary.totalDebit << std::endl;
+        totalCredit += summary.totalCredit;
+        totalDebit += summary.totalDebit;
+        totalCount += summary.transactionCount;
+    }
+
+    std::cout << "------------------------------------------------" << std::endl;
+    std::cout << "Transactions: " << totalCount << std::endl;
+    std::cout << "Total Credit: " << totalCredit << " " << currency << std::endl;
+    std::cout << "Total Debit: " << totalDebit << " " << currency << std::endl;
+    std::cout << "Net Balance: " << (totalCredit - totalDebit) << " " << currency << std::endl;
+    std::cout << std::setprecision(0);
+    std::cout << "Distinct merchants: ~" << sketches.getDistinctMerchants() << std::endl;
+    std::cout << std::setprecision(2);
+    std::cout << "Resident ledgers: " << getResidentCount() << " ("
+              << getResidentMemory() / 1024 << " KB)" << std::endl;
+    std::cout << "================================================" << std::endl;
+    std::cout << std::endl;
+}
+
+int LedgerRegistry::getLedgerCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return shards.size();
+}
+
+int LedgerRegistry::getResidentCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    int resident = 0;
+    for (const auto& shard : shards) {
+        if (shard.manager) {
+            resident++;
+        }
+    }
+    return resident;
+}
+
+size_t LedgerRegistry::getResidentMemory() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return residentMemory;
+}
+
+std::vector<std::string> LedgerRegistry::getLedgerNames() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> names;
+    for (const auto& shard : shards) {
+        names.push_back(shard.name);
+    }
+    return names;
+}
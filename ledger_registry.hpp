@@ -0,0 +1,71 @@
+#ifndef LEDGER_REGISTRY_HPP
+#define LEDGER_REGISTRY_HPP
+
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "transaction_manager.hpp"
+#include "currency_converter.hpp"
+#include "ledger_sketches.hpp"
+
+// Per-ledger totals produced by a consolidated report, converted to 'currency'
+struct LedgerSummary {
+    std::string name;
+    int transactionCount;
+    std::string currency;
+    double totalCredit;
+    double totalDebit;
+};
+
+// Registry of many ledgers (one CSV file per account or partition).
+// Ledgers are loaded lazily on first use and kept resident until the
+// estimated memory of all resident ledgers exceeds the budget, at which
+// point the least recently used ones are unloaded.
+class LedgerRegistry {
+private:
+    struct Shard {
+        std::string name;
+        std::string filename;
+        std::shared_ptr<TransactionManager> manager;   // null while not resident
+        size_t memoryUsage;
+        unsigned long lastUsed;
+    };
+
+    std::vector<Shard> shards;
+    std::map<std::string, size_t> shardIndex;
+    CurrencyConverter* converter;
+    size_t memoryBudget;
+    size_t residentMemory;
+    unsigned long useClock;
+    mutable std::mutex mutex;
+
+    std::shared_ptr<TransactionManager> acquire(size_t index);
+    void evictOverBudget(size_t keep, std::vector<std::shared_ptr<TransactionManager>>& evicted);
+
+public:
+    LedgerRegistry(CurrencyConverter* curr, size_t budgetBytes);
+
+    // Registration (does not load anything)
+    bool openLedger(const std::string& name, const std::string& file);
+    int openDirectory(const std::string& directory);
+
+    // Returns the ledger, loading it if needed. The returned pointer keeps the
+    // ledger alive even if the registry unloads it afterwards.
+    std::shared_ptr<TransactionManager> getLedger(const std::string& name);
+
+    // Consolidated reports across all shards, computed in parallel. If
+    // 'sketches' is given, every ledger's sketches are merged into it in the same pass.
+    std::vector<LedgerSummary> summarizeAll(const std::string& currency, unsigned threads = 0,
+                                            LedgerSketches* sketches = nullptr);
+    void displayConsolidatedReport(const std::string& currency, unsigned threads = 0);
+
+    // Getters
+    int getLedgerCount() const;
+    int getResidentCount() const;
+    size_t getResidentMemory() const;
+    std::vector<std::string> getLedgerNames() const;
+};
+
+#endif
@@ -0,0 +1,510 @@
+#include "ledger_sketches.hpp"
+#include "description_index.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+static const char SKETCH_MAGIC[4] = {'M', 'S', 'K', 'T'};
+static const uint32_t SKETCH_VERSION = 4;
+static const int HLL_BITS = 12;
+
+namespace {
+
+// Values are stored in host byte order
+template <typename T>
+void writeValue(std::ostream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+void writeString(std::ostream& out, const std::string& text) {
+    writeValue<uint32_t>(out, static_cast<uint32_t>(text.size()));
+    out.write(text.data(), text.size());
+}
+
+bool readString(std::istream& in, std::string& text) {
+    uint32_t length;
+    if (!readValue(in, length) || length > (1u << 20)) {
+        return false;
+    }
+    text.resize(length);
+    return static_cast<bool>(in.read(&text[0], length));
+}
+
+// FNV-1a followed by a MurmurHash3 finalizer for well mixed high bits
+uint64_t hash64(const std::string& value) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (unsigned char c : value) {
+        h = (h ^ c) * 0x100000001b3ull;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+}
+
+// KLL
+
+KllSketch::KllSketch(uint32_t accuracy) : k(accuracy), levels(1), count(0), randomState(0x9E3779B9u) {}
+
+// Top level holds k items, each level below two thirds of the one above
+uint32_t KllSketch::capacity(size_t level) const {
+    size_t depth = levels.size() - 1 - level;
+    double cap = k * std::pow(2.0 / 3.0, static_cast<double>(depth));
+    return std::max<uint32_t>(2, static_cast<uint32_t>(std::ceil(cap)));
+}
+
+void KllSketch::compact(size_t level) {
+    if (level + 1 == levels.size()) {
+        levels.emplace_back();
+    }
+
+    std::vector<float>& items = levels[level];
+    std::sort(items.begin(), items.end());
+
+    // With an odd count the largest item stays behind
+    float leftover = 0.0f;
+    bool odd = items.size() % 2 == 1;
+    if (odd) {
+        leftover = items.back();
+        items.pop_back();
+    }
+
+    // xorshift picks even or odd positions so the error stays unbiased
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    for (size_t i = randomState & 1; i < items.size(); i += 2) {
+        levels[level + 1].push_back(items[i]);
+    }
+
+    items.clear();
+    if (odd) {
+        items.push_back(leftover);
+    }
+}
+
+void KllSketch::compress() {
+    for (size_t level = 0; level < levels.size(); level++) {
+        if (levels[level].size() >= capacity(level)) {
+            compact(level);
+        }
+    }
+}
+
+void KllSketch::add(float value) {
+    levels[0].push_back(value);
+    count++;
+    if (levels[0].size() >= capacity(0)) {
+        compress();
+    }
+}
+
+void KllSketch::merge(const KllSketch& other) {
+    while (levels.size() < other.levels.size()) {
+        levels.emplace_back();
+    }
+    for (size_t level = 0; level < other.levels.size(); level++) {
+        levels[level].insert(levels[level].end(), other.levels[level].begin(), other.levels[level].end());
+    }
+    count += other.count;
+    compress();
+}
+
+float KllSketch::quantile(double q) const {
+    std::vector<std::pair<float, uint64_t>> weighted;
+    uint64_t total = 0;
+    for (size_t level = 0; level < levels.size(); level++) {
+        for (float value : levels[level]) {
+            weighted.emplace_back(value, uint64_t(1) << level);
+            total += uint64_t(1) << level;
+        }
+    }
+    if (weighted.empty()) {
+        return 0.0f;
+    }
+
+    std::sort(weighted.begin(), weighted.end());
+    double target = std::min(1.0, std::max(0.0, q)) * total;
+    uint64_t seen = 0;
+    for (const auto& [value, weight] : weighted) {
+        seen += weight;
+        if (seen >= target) {
+            return value;
+        }
+    }
+    return weighted.back().first;
+}
+
+uint64_t KllSketch::getCount() const {
+    return count;
+}
+
+size_t KllSketch::getMemoryUsage() const {
+    size_t bytes = sizeof(*this);
+    for (const auto& items : levels) {
+        bytes += sizeof(items) + items.capacity() * sizeof(float);
+    }
+    return bytes;
+}
+
+void KllSketch::write(std::ostream& out) const {
+    writeValue(out, k);
+    writeValue(out, count);
+    writeValue(out, randomState);
+    writeValue<uint32_t>(out, static_cast<uint32_t>(levels.size()));
+    for (const auto& items : levels) {
+        writeValue<uint32_t>(out, static_cast<uint32_t>(items.size()));
+        out.write(reinterpret_cast<const char*>(items.data()), items.size() * sizeof(float));
+    }
+}
+
+bool KllSketch::read(std::istream& in) {
+    uint32_t levelCount;
+    if (!readValue(in, k) || !readValue(in, count) || !readValue(in, randomState) ||
+        !readValue(in, levelCount) || levelCount == 0 || levelCount > 64) {
+        return false;
+    }
+
+    levels.assign(levelCount, std::vector<float>());
+    for (auto& items : levels) {
+        uint32_t size;
+        if (!readValue(in, size) || size > k * 4) {
+            return false;
+        }
+        items.resize(size);
+        if (!in.read(reinterpret_cast<char*>(items.data()), size * sizeof(float))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// HyperLogLog
+
+HyperLogLog::HyperLogLog() : registers(size_t(1) << HLL_BITS, 0) {}
+
+void HyperLogLog::add(const std::string& value) {
+    uint64_t h = hash64(value);
+    size_t index = h >> (64 - HLL_BITS);
+
+    // Rank of the first set bit in the remaining bits
+    uint64_t rest = h << HLL_BITS;
+    uint8_t rank = 1;
+    while (rank <= 64 - HLL_BITS && !(rest & (uint64_t(1) << 63))) {
+        rest <<= 1;
+        rank++;
+    }
+    registers[index] = std::max(registers[index], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    for (size_t i = 0; i < registers.size(); i++) {
+        registers[i] = std::max(registers[i], other.registers[i]);
+    }
+}
+
+double HyperLogLog::estimate() const {
+    double m = static_cast<double>(registers.size());
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (uint8_t value : registers) {
+        sum += std::ldexp(1.0, -value);
+        if (value == 0) {
+            zeros++;
+        }
+    }
+
+    double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double estimate = alpha * m * m / sum;
+
+    // Small cardinalities: linear counting is more accurate
+    if (estimate <= 2.5 * m && zeros > 0) {
+        estimate = m * std::log(m / zeros);
+    }
+    return estimate;
+}
+
+size_t HyperLogLog::getMemoryUsage() const {
+    return sizeof(*this) + registers.capacity();
+}
+
+void HyperLogLog::write(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(registers.data()), registers.size());
+}
+
+bool HyperLogLog::read(std::istream& in) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(registers.data()), registers.size()));
+}
+
+// Space-Saving
+
+SpaceSaving::SpaceSaving(size_t slots) : capacity(slots) {}
+
+void SpaceSaving::add(const std::string& value) {
+    auto it = counters.find(value);
+    if (it != counters.end()) {
+        it->second.count++;
+        return;
+    }
+    if (counters.size() < capacity) {
+        counters[value] = {1, 0};
+        return;
+    }
+
+    // Replace the smallest counter; the newcomer inherits its count as error
+    auto smallest = std::min_element(counters.begin(), counters.end(),
+                                     [](const auto& a, const auto& b) {
+                                         return a.second.count < b.second.count;
+                                     });
+    uint64_t floor = smallest->second.count;
+    counters.erase(smallest);
+    counters[value] = {floor + 1, floor};
+}
+
+// A value missing from a full summary may still have occurred up to its
+// smallest count, so that count is added to both the estimate and the error
+uint64_t SpaceSaving::floorCount() const {
+    if (counters.size() < capacity) {
+        return 0;
+    }
+    uint64_t floor = UINT64_MAX;
+    for (const auto& [value, counter] : counters) {
+        floor = std::min(floor, counter.count);
+    }
+    return floor;
+}
+
+void SpaceSaving::merge(const SpaceSaving& other) {
+    uint64_t ownFloor = floorCount();
+    uint64_t otherFloor = other.floorCount();
+
+    for (auto& [value, counter] : counters) {
+        if (other.counters.find(value) == other.counters.end()) {
+            counter.count += otherFloor;
+            counter.error += otherFloor;
+        }
+    }
+    for (const auto& [value, counter] : other.counters) {
+        auto it = counters.find(value);
+        if (it != counters.end()) {
+            it->second.count += counter.count;
+            it->second.error += counter.error;
+        } else {
+            counters[value] = {counter.count + ownFloor, counter.error + ownFloor};
+        }
+    }
+
+    // Keep the largest 'capacity' counters
+    while (counters.size() > capacity) {
+        auto smallest = std::min_element(counters.begin(), counters.end(),
+                                         [](const auto& a, const auto& b) {
+                                             return a.second.count < b.second.count;
+                                         });
+        counters.erase(smallest);
+    }
+}
+
+std::vector<std::pair<std::string, uint64_t>> SpaceSaving::top(size_t n) const {
+    std::vector<std::pair<std::string, uint64_t>> result;
+    for (const auto& [value, counter] : counters) {
+        // Report only what is guaranteed; entries made up entirely of error are skipped
+        if (counter.count > counter.error) {
+            result.emplace_back(value, counter.count - counter.error);
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+        return a.second > b.second;
+    });
+    if (result.size() > n) {
+        result.resize(n);
+    }
+    return result;
+}
+
+size_t SpaceSaving::getMemoryUsage() const {
+    size_t bytes = sizeof(*this);
+    for (const auto& [value, counter] : counters) {
+        // Approximate per-node overhead of the map
+        bytes += sizeof(value) + value.capacity() + sizeof(counter) + 4 * sizeof(void*);
+    }
+    return bytes;
+}
+
+void SpaceSaving::write(std::ostream& out) const {
+    writeValue<uint32_t>(out, static_cast<uint32_t>(counters.size()));
+    for (const auto& [value, counter] : counters) {
+        writeString(out, value);
+        writeValue(out, counter.count);
+        writeValue(out, counter.error);
+    }
+}
+
+bool SpaceSaving::read(std::istream& in) {
+    uint32_t size;
+    if (!readValue(in, size) || size > capacity) {
+        return false;
+    }
+
+    counters.clear();
+    for (uint32_t i = 0; i < size; i++) {
+        std::string value;
+        Counter counter;
+        if (!readString(in, value) || !readValue(in, counter.count) || !readValue(in, counter.error)) {
+            return false;
+        }
+        counters[value] = counter;
+    }
+    return true;
+}
+
+// LedgerSketches
+
+LedgerSketches::LedgerSketches() : rowCount(0) {}
+
+void LedgerSketches::add(const Transaction& transaction) {
+    std::string merchant = DescriptionIndex::toLower(transaction.getDescription());
+    merchants.add(merchant);
+    topMerchants.add(merchant);
+
+    if (transaction.getType() == "debit") {
+        categorySpend[{transaction.getCategory(), transaction.getCurrency()}].add(transaction.getAmount());
+    }
+    rowCount++;
+}
+
+void LedgerSketches::merge(const LedgerSketches& other) {
+    for (const auto& [key, sketch] : other.categorySpend) {
+        categorySpend[key].merge(sketch);
+    }
+    merchants.merge(other.merchants);
+    topMerchants.merge(other.topMerchants);
+    rowCount += other.rowCount;
+}
+
+void LedgerSketches::clear() {
+    *this = LedgerSketches();
+}
+
+uint64_t LedgerSketches::hashLine(uint64_t hash, const std::string& line) {
+    // FNV-1a over the line plus a terminator, so line boundaries count too
+    for (unsigned char c : line) {
+        hash = (hash ^ c) * 0x100000001b3ull;
+    }
+    return (hash ^ '\n') * 0x100000001b3ull;
+}
+
+bool LedgerSketches::save(const std::string& file, uint64_t sourceHash) const {
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    out.write(SKETCH_MAGIC, sizeof(SKETCH_MAGIC));
+    writeValue(out, SKETCH_VERSION);
+    writeValue(out, rowCount);
+    writeValue(out, sourceHash);
+
+    merchants.write(out);
+    topMerchants.write(out);
+
+    writeValue<uint32_t>(out, static_cast<uint32_t>(categorySpend.size()));
+    for (const auto& [key, sketch] : categorySpend) {
+        writeString(out, key.first);
+        writeString(out, key.second);
+        sketch.write(out);
+    }
+    return static_cast<bool>(out);
+}
+
+bool LedgerSketches::load(const std::string& file, uint64_t expectedRows, uint64_t sourceHash) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+
+    char magic[sizeof(SKETCH_MAGIC)];
+    uint32_t version;
+    uint64_t rows, hash;
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), SKETCH_MAGIC) ||
+        !readValue(in, version) || version != SKETCH_VERSION ||
+        !readValue(in, rows) || rows != expectedRows ||
+        !readValue(in, hash) || hash != sourceHash) {
+        return false;
+    }
+
+    LedgerSketches loaded;
+    loaded.rowCount = rows;
+    uint32_t categories;
+    if (!loaded.merchants.read(in) ||
+        !loaded.topMerchants.read(in) || !readValue(in, categories)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < categories; i++) {
+        std::string category, currency;
+        if (!readString(in, category) || !readString(in, currency) ||
+            !loaded.categorySpend[{category, currency}].read(in)) {
+            return false;
+        }
+    }
+
+    *this = loaded;
+    return true;
+}
+
+void LedgerSketches::display() const {
+    if (rowCount == 0) {
+        std::cout << "No transactions to analyse." << std::endl;
+        return;
+    }
+
+    std::cout << std::endl;
+    std::cout << "================================================" << std::endl;
+    std::cout << "Approximate Analytics (" << rowCount << " transactions):" << std::endl;
+    std::cout << "================================================" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::cout << "Spending percentiles per category:" << std::endl;
+    for (const auto& [key, sketch] : categorySpend) {
+        std::cout << "  " << key.first << " (" << key.second << "): median " << sketch.quantile(0.5)
+                  << ", p90 " << sketch.quantile(0.9)
+                  << ", p99 " << sketch.quantile(0.99)
+                  << " (" << sketch.getCount() << " debits)" << std::endl;
+    }
+
+    std::cout << std::setprecision(0);
+    std::cout << "Distinct merchants: ~" << merchants.estimate() << std::endl;
+
+    std::cout << "Most frequent merchants:" << std::endl;
+    for (const auto& [merchant, count] : topMerchants.top(5)) {
+        std::cout << "  " << merchant << ": at least " << count << " transactions" << std::endl;
+    }
+    std::cout << std::setprecision(2);
+    std::cout << "================================================" << std::endl;
+    std::cout << std::endl;
+}
+
+uint64_t LedgerSketches::getRowCount() const {
+    return rowCount;
+}
+
+size_t LedgerSketches::getMemoryUsage() const {
+    size_t bytes = sizeof(*this) + merchants.getMemoryUsage() + topMerchants.getMemoryUsage();
+    for (const auto& [key, sketch] : categorySpend) {
+        bytes += key.first.size() + key.second.size() + sketch.getMemoryUsage();
+    }
+    return bytes;
+}
+
+double LedgerSketches::getDistinctMerchants() const {
+    return merchants.estimate();
+}
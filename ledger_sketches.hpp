@@ -0,0 +1,121 @@
+#ifndef LEDGER_SKETCHES_HPP
+#define LEDGER_SKETCHES_HPP
+
+#include <vector>
+#include <string>
+#include <map>
+#include <iostream>
+#include <cstdint>
+#include "transaction.hpp"
+
+// Sketches are saved next to the ledger file, e.g. transactions.csv.sketch
+#define SKETCH_FILE_SUFFIX ".sketch"
+#define SKETCH_HASH_SEED 0xcbf29ce484222325ull
+
+// Small-footprint approximate summaries. Every sketch can be merged with
+// another of the same kind, so per-thread or per-ledger sketches combine
+// into one without revisiting the rows.
+
+// KLL quantile sketch: compactors of shrinking capacity; each compaction
+// keeps every other sorted item and doubles its weight
+class KllSketch {
+private:
+    uint32_t k;
+    std::vector<std::vector<float>> levels;
+    uint64_t count;
+    uint32_t randomState;
+
+    uint32_t capacity(size_t level) const;
+    void compact(size_t level);
+    void compress();
+
+public:
+    explicit KllSketch(uint32_t accuracy = 200);
+
+    void add(float value);
+    void merge(const KllSketch& other);
+    float quantile(double q) const;     // q in [0, 1]
+    uint64_t getCount() const;
+    size_t getMemoryUsage() const;
+
+    void write(std::ostream& out) const;
+    bool read(std::istream& in);
+};
+
+// HyperLogLog distinct counter with 2^12 registers (about 1.6% error)
+class HyperLogLog {
+private:
+    std::vector<uint8_t> registers;
+
+public:
+    HyperLogLog();
+
+    void add(const std::string& value);
+    void merge(const HyperLogLog& other);
+    double estimate() const;
+    size_t getMemoryUsage() const;
+
+    void write(std::ostream& out) const;
+    bool read(std::istream& in);
+};
+
+// Space-Saving heavy hitters: tracks the most frequent values in fixed space
+class SpaceSaving {
+private:
+    struct Counter {
+        uint64_t count;
+        uint64_t error;     // count may overstate the true frequency by this much
+    };
+
+    size_t capacity;
+    std::map<std::string, Counter> counters;
+
+    uint64_t floorCount() const;
+
+public:
+    explicit SpaceSaving(size_t slots = 32);
+
+    void add(const std::string& value);
+    void merge(const SpaceSaving& other);
+    // Most frequent values with their guaranteed counts (count minus error)
+    std::vector<std::pair<std::string, uint64_t>> top(size_t n) const;
+    size_t getMemoryUsage() const;
+
+    void write(std::ostream& out) const;
+    bool read(std::istream& in);
+};
+
+// The sketches kept for a ledger: spend percentiles per category and currency,
+// distinct merchants and the most frequent merchants (merchant = lowercased description)
+class LedgerSketches {
+private:
+    // Amounts are never mixed across currencies: keyed by (category, currency)
+    std::map<std::pair<std::string, std::string>, KllSketch> categorySpend;
+    HyperLogLog merchants;
+    SpaceSaving topMerchants;
+    uint64_t rowCount;
+
+public:
+    LedgerSketches();
+
+    void add(const Transaction& transaction);
+    void merge(const LedgerSketches& other);
+    void clear();
+
+    // Persistence; 'sourceHash' (see hashLine) ties the sketches to the exact
+    // contents of one ledger file so stale sketches are rejected on load
+    bool save(const std::string& file, uint64_t sourceHash) const;
+    bool load(const std::string& file, uint64_t expectedRows, uint64_t sourceHash);
+
+    // Folds one ledger line into a running content hash, starting from SKETCH_HASH_SEED
+    static uint64_t hashLine(uint64_t hash, const std::string& line);
+
+    void display() const;
+
+    // Getters
+    uint64_t getRowCount() const;
+    size_t getMemoryUsage() const;
+    double getDistinctMerchants() const;
+};
+
+#endif
@@ -4,11 +4,27 @@
 #include <algorithm>
 #include "transaction_manager.hpp"
 #include "currency_converter.hpp"
+#include "ledger_registry.hpp"
+#include "budget_engine.hpp"
+#include "block_ledger.hpp"
+
+// Account ledgers for consolidated reports, one CSV file per account
+#define LEDGER_DIRECTORY "ledgers"
+#define LEDGER_MEMORY_BUDGET (64u * 1024u * 1024u)
+
+// Optional budget and limit rules, see README
+#define BUDGET_RULES_FILE "budgets.csv"
+
+// Compressed archive of the main ledger
+#define ARCHIVE_FILE "transactions.mlb"
 
 class MonefyApp {
 private:
     TransactionManager* transactionManager;
     CurrencyConverter* currencyConverter;
+    LedgerRegistry* ledgerRegistry;
+    ConsoleAlertSink alertSink;
+    BudgetEngine* budgetEngine;
     std::string baseCurrency;
 
     void displayMainMenu() {
@@ -20,14 +36,64 @@ private:
         std::cout << "3. Find where you spent the most money\n";
         std::cout << "4. Track dues\n";
         std::cout << "5. Check transaction limit\n";
-        std::cout << "6. Exit\n";
+        std::cout << "6. Consolidated report across all ledgers\n";
+        std::cout << "7. Search transactions by description\n";
+        std::cout << "8. Export compressed archive\n";
+        std::cout << "9. Query compressed archive\n";
+        std::cout << "10. Grouped spending report\n";
+        std::cout << "11. Approximate spending analytics\n";
+        std::cout << "12. Exit\n";
         std::cout << "**************************************************************\n";
     }
 
+    void queryArchive() {
+        BlockLedgerFile archive;
+        if (!archive.open(ARCHIVE_FILE)) {
+            std::cout << "No archive found. Export one first." << std::endl;
+            return;
+        }
+
+        BlockQuery query;
+        std::cout << "Category (blank for any): ";
+        std::cin.ignore();
+        std::getline(std::cin, query.category);
+        std::cout << "Currency (blank for any): ";
+        std::getline(std::cin, query.currency);
+        std::transform(query.currency.begin(), query.currency.end(), query.currency.begin(), ::toupper);
+        std::cout << "From date YYYY-MM-DD (blank for any): ";
+        std::getline(std::cin, query.fromDate);
+        std::cout << "To date YYYY-MM-DD (blank for any): ";
+        std::getline(std::cin, query.toDate);
+        std::cout << "Minimum amount: ";
+        std::cin >> query.minAmount;
+
+        std::vector<Transaction> matches = archive.query(query);
+
+        std::cout << std::endl;
+        std::cout << "================================================" << std::endl;
+        std::cout << matches.size() << " matching transactions (read " << archive.getBlocksRead()
+                  << " of " << archive.getBlockCount() << " blocks):" << std::endl;
+        std::cout << "================================================" << std::endl;
+        for (size_t i = 0; i < matches.size(); i++) {
+            std::cout << i + 1 << ". ";
+            matches[i].display();
+        }
+        std::cout << "================================================" << std::endl;
+        std::cout << std::endl;
+    }
+
 public:
     MonefyApp() : baseCurrency("INR") {
         currencyConverter = new CurrencyConverter("");
         transactionManager = new TransactionManager("transactions.csv", currencyConverter);
+        ledgerRegistry = new LedgerRegistry(currencyConverter, LEDGER_MEMORY_BUDGET);
+        ledgerRegistry->openDirectory(LEDGER_DIRECTORY);
+
+        budgetEngine = new BudgetEngine(&alertSink);
+        if (budgetEngine->loadRules(BUDGET_RULES_FILE) && budgetEngine->getRuleCount() > 0) {
+            std::cout << "Loaded " << budgetEngine->getRuleCount() << " budget rules" << std::endl;
+            transactionManager->setBudgetEngine(budgetEngine);
+        }
         
         // Initialize with default currency
         std::cout << "Initializing exchange rates for INR..." << std::endl;
@@ -75,7 +141,31 @@ public:
                     break;
                 }
 
-                case 6: {
+                case 6:
+                    ledgerRegistry->displayConsolidatedReport(baseCurrency);
+                    break;
+
+                case 7:
+                    transactionManager->searchByDescription();
+                    break;
+
+                case 8:
+                    transactionManager->exportArchive(ARCHIVE_FILE);
+                    break;
+
+                case 9:
+                    queryArchive();
+                    break;
+
+                case 10:
+                    transactionManager->groupedReport();
+                    break;
+
+                case 11:
+                    transactionManager->displayApproximateAnalytics();
+                    break;
+
+                case 12: {
                     std::cout << "\n";
                     std::cout << "========================================\n";
                     std::cout << "Thank you for using Monefy!\n";
@@ -91,7 +181,9 @@ public:
     }
 
     ~MonefyApp() {
+        delete ledgerRegistry;
         delete transactionManager;
+        delete budgetEngine;
         delete currencyConverter;
     }
 };
@@ -0,0 +1,31 @@
+#include "string_interner.hpp"
+
+uint32_t StringInterner::intern(const std::string& text) {
+    auto it = ids.find(text);
+    if (it != ids.end()) {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(strings.size());
+    ids.emplace(text, id);
+    strings.push_back(text);
+    return id;
+}
+
+uint32_t StringInterner::find(const std::string& text) const {
+    auto it = ids.find(text);
+    return (it != ids.end()) ? it->second : NOT_FOUND;
+}
+
+const std::string& StringInterner::getString(uint32_t id) const {
+    return strings[id];
+}
+
+uint32_t StringInterner::size() const {
+    return static_cast<uint32_t>(strings.size());
+}
+
+void StringInterner::clear() {
+    ids.clear();
+    strings.clear();
+}
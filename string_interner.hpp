@@ -0,0 +1,26 @@
+#ifndef STRING_INTERNER_HPP
+#define STRING_INTERNER_HPP
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+// Maps strings (categories, currencies, months...) to dense ids 0, 1, 2, ...
+// so they can index flat tables instead of string-keyed maps.
+class StringInterner {
+private:
+    std::unordered_map<std::string, uint32_t> ids;
+    std::vector<std::string> strings;
+
+public:
+    static const uint32_t NOT_FOUND = UINT32_MAX;
+
+    uint32_t intern(const std::string& text);
+    uint32_t find(const std::string& text) const;   // NOT_FOUND if never interned
+    const std::string& getString(uint32_t id) const;
+    uint32_t size() const;
+    void clear();
+};
+
+#endif
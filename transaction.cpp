@@ -1,14 +1,16 @@
 #include "transaction.hpp"
 #include <sstream>
 #include <iomanip>
+#include <ctime>
 
 // Constructor
 Transaction::Transaction() 
-    : description(""), amount(0.0f), type("debit"), category(""), currency("INR") {}
+    : description(""), amount(0.0f), type("debit"), category(""), currency("INR"), date("") {}
 
 Transaction::Transaction(const std::string& desc, float amt, const std::string& typ, 
-                         const std::string& cat, const std::string& curr)
-    : description(desc), amount(amt), type(typ), category(cat), currency(curr) {}
+                         const std::string& cat, const std::string& curr,
+                         const std::string& dt)
+    : description(desc), amount(amt), type(typ), category(cat), currency(curr), date(dt) {}
 
 // Getters
 std::string Transaction::getDescription() const {
@@ -31,6 +33,14 @@ std::string Transaction::getCurrency() const {
     return currency;
 }
 
+std::string Transaction::getDate() const {
+    return date;
+}
+
+std::string Transaction::getMonth() const {
+    return date.substr(0, 7);
+}
+
 // Setters
 void Transaction::setDescription(const std::string& desc) {
     description = desc;
@@ -52,24 +62,35 @@ void Transaction::setCurrency(const std::string& curr) {
     currency = curr;
 }
 
+void Transaction::setDate(const std::string& dt) {
+    date = dt;
+}
+
 // Display transaction
 void Transaction::display() const {
     std::cout << std::fixed << std::setprecision(2);
     std::cout << description << ": " << amount << " " << currency 
-              << " (" << type << ") - " << category << std::endl;
+              << " (" << type << ") - " << category;
+    if (!date.empty()) {
+        std::cout << " [" << date << "]";
+    }
+    std::cout << std::endl;
 }
 
 // Convert to CSV format
 std::string Transaction::toCSV() const {
     std::stringstream ss;
     ss << description << "," << amount << "," << type << "," << category << "," << currency;
+    if (!date.empty()) {
+        ss << "," << date;
+    }
     return ss.str();
 }
 
 // Create Transaction from CSV line
 Transaction Transaction::fromCSV(const std::string& line) {
     std::stringstream ss(line);
-    std::string desc, type, category, currency;
+    std::string desc, type, category, currency, date;
     float amount;
 
     std::getline(ss, desc, ',');
@@ -77,12 +98,22 @@ Transaction Transaction::fromCSV(const std::string& line) {
     ss.ignore(); // Skip the comma
     std::getline(ss, type, ',');
     std::getline(ss, category, ',');
-    std::getline(ss, currency);
+    std::getline(ss, currency, ',');
+    std::getline(ss, date);
 
     // Handle missing currency field (for backward compatibility)
     if (currency.empty()) {
         currency = "INR";
     }
 
-    return Transaction(desc, amount, type, category, currency);
+    return Transaction(desc, amount, type, category, currency, date);
+}
+
+// Today's date as YYYY-MM-DD
+std::string Transaction::currentDate() {
+    std::time_t now = std::time(nullptr);
+    std::tm local = *std::localtime(&now);
+    std::stringstream ss;
+    ss << std::put_time(&local, "%Y-%m-%d");
+    return ss.str();
 }
\ No newline at end of file
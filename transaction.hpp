@@ -4,7 +4,6 @@
 #include <string>
 #include <iostream>
 
-#define MAX_TRANSACTIONS 100
 #define MAX_DESC_LENGTH 50
 #define MAX_NAME_LENGTH 50
 
@@ -15,12 +14,14 @@ private:
     std::string type;        // "credit" or "debit"
     std::string category;
     std::string currency;    // Currency code (USD, INR, EUR, etc.)
+    std::string date;        // YYYY-MM-DD, empty for rows saved before dates were recorded
 
 public:
     // Constructor
     Transaction();
     Transaction(const std::string& desc, float amt, const std::string& typ, 
-                const std::string& cat, const std::string& curr = "INR");
+                const std::string& cat, const std::string& curr = "INR",
+                const std::string& dt = "");
 
     // Getters
     std::string getDescription() const;
@@ -28,6 +29,8 @@ public:
     std::string getType() const;
     std::string getCategory() const;
     std::string getCurrency() const;
+    std::string getDate() const;
+    std::string getMonth() const;   // YYYY-MM, empty if undated
 
     // Setters
     void setDescription(const std::string& desc);
@@ -35,11 +38,13 @@ public:
     void setType(const std::string& typ);
     void setCategory(const std::string& cat);
     void setCurrency(const std::string& curr);
+    void setDate(const std::string& dt);
 
     // Utility
     void display() const;
     std::string toCSV() const;
     static Transaction fromCSV(const std::string& line);
+    static std::string currentDate();
 };
 
 #endif
\ No newline at end of file
@@ -1,13 +1,15 @@
 #include "transaction_manager.hpp"
+#include "block_ledger.hpp"
+#include "group_by.hpp"
 #include <fstream>
 #include <sstream>
 #include <algorithm>
-#include <map>
 #include <iomanip>
 #include <iostream>
 
 TransactionManager::TransactionManager(const std::string& file, CurrencyConverter* curr)
-    : filename(file), converter(curr), defaultCurrency("INR") {
+    : filename(file), converter(curr), defaultCurrency("INR"), modified(false),
+      budgetEngine(nullptr) {
     loadTransactions();
 }
 
@@ -19,12 +21,30 @@ void TransactionManager::loadTransactions() {
     }
 
     std::string line;
-    while (std::getline(file, line) && transactions.size() < MAX_TRANSACTIONS) {
+    uint64_t contentHash = SKETCH_HASH_SEED;
+    while (std::getline(file, line)) {
         if (!line.empty()) {
+            contentHash = LedgerSketches::hashLine(contentHash, line);
             transactions.push_back(Transaction::fromCSV(line));
+            descriptionIndex.addRow(transactions.back().getDescription());
+            addToTotals(transactions.back());
+            if (budgetEngine) {
+                budgetEngine->evaluate(transactions.back());
+            }
         }
     }
     file.close();
+
+    // Saved sketches are only trusted if they match this exact file content
+    if (!sketches.load(filename + SKETCH_FILE_SUFFIX, transactions.size(), contentHash)) {
+        sketches.clear();
+        for (const auto& transaction : transactions) {
+            sketches.add(transaction);
+        }
+        // Persist the rebuilt sketches so the next load can skip this pass
+        sketches.save(filename + SKETCH_FILE_SUFFIX, contentHash);
+    }
+
     std::cout << "Loaded " << transactions.size() << " transactions" << std::endl;
 }
 
@@ -35,19 +55,29 @@ void TransactionManager::saveTransactions() {
         return;
     }
 
+    uint64_t contentHash = SKETCH_HASH_SEED;
     for (const auto& transaction : transactions) {
-        file << transaction.toCSV() << std::endl;
+        std::string line = transaction.toCSV();
+        file << line << std::endl;
+        contentHash = LedgerSketches::hashLine(contentHash, line);
     }
     file.close();
+    modified = false;
+
+    sketches.save(filename + SKETCH_FILE_SUFFIX, contentHash);
+
     std::cout << "Transactions saved successfully" << std::endl;
 }
 
-void TransactionManager::addTransaction() {
-    if (transactions.size() >= MAX_TRANSACTIONS) {
-        std::cerr << "Error: Maximum number of transactions reached." << std::endl;
-        return;
+bool TransactionManager::exportArchive(const std::string& archiveFile) const {
+    if (!BlockLedgerFile::write(archiveFile, transactions)) {
+        return false;
     }
+    std::cout << "Archived " << transactions.size() << " transactions to " << archiveFile << std::endl;
+    return true;
+}
 
+void TransactionManager::addTransaction() {
     std::string description, type, category, currency;
     float amount;
 
@@ -78,7 +108,14 @@ void TransactionManager::addTransaction() {
         }
     }
 
-    transactions.emplace_back(description, amount, type, category, currency);
+    transactions.emplace_back(description, amount, type, category, currency, Transaction::currentDate());
+    descriptionIndex.addRow(description);
+    addToTotals(transactions.back());
+    sketches.add(transactions.back());
+    if (budgetEngine) {
+        budgetEngine->evaluate(transactions.back());
+    }
+    modified = true;
     saveTransactions();
 
     std::cout << "Transaction added successfully!" << std::endl;
@@ -103,14 +140,111 @@ void TransactionManager::displayAllTransactions() const {
     std::cout << std::endl;
 }
 
+std::vector<size_t> TransactionManager::searchTransactions(const SearchQuery& query) const {
+    std::vector<size_t> matches;
+    std::string needle = DescriptionIndex::toLower(query.text);
+
+    auto matchesQuery = [&](const Transaction& transaction) {
+        if (!query.category.empty() && transaction.getCategory() != query.category) {
+            return false;
+        }
+        if (!query.type.empty() && transaction.getType() != query.type) {
+            return false;
+        }
+        if (transaction.getAmount() < query.minAmount ||
+            (query.maxAmount >= 0.0f && transaction.getAmount() > query.maxAmount)) {
+            return false;
+        }
+
+        // Trigram candidates can be false positives, so always check the text
+        std::string description = DescriptionIndex::toLower(transaction.getDescription());
+        size_t pos = description.find(needle);
+        return query.prefix ? pos == 0 : pos != std::string::npos;
+    };
+
+    std::vector<uint32_t> candidates;
+    if (descriptionIndex.findCandidates(query.text, query.prefix, candidates)) {
+        for (uint32_t row : candidates) {
+            if (matchesQuery(transactions[row])) {
+                matches.push_back(row);
+            }
+        }
+    } else {
+        // Query too short for trigrams
+        for (size_t i = 0; i < transactions.size(); i++) {
+            if (matchesQuery(transactions[i])) {
+                matches.push_back(i);
+            }
+        }
+    }
+    return matches;
+}
+
+void TransactionManager::searchByDescription() const {
+    SearchQuery query;
+    std::string mode;
+
+    std::cout << "Enter text to search for: ";
+    std::cin.ignore();
+    std::getline(std::cin, query.text);
+
+    std::cout << "Match at start of description only? (y/n): ";
+    std::getline(std::cin, mode);
+    query.prefix = (mode == "y" || mode == "Y");
+
+    std::cout << "Filter by category (blank for any): ";
+    std::getline(std::cin, query.category);
+
+    std::cout << "Filter by type (credit/debit, blank for any): ";
+    std::getline(std::cin, query.type);
+
+    std::cout << "Minimum amount (0 for any): ";
+    std::cin >> query.minAmount;
+
+    std::cout << "Maximum amount (-1 for any): ";
+    std::cin >> query.maxAmount;
+
+    std::vector<size_t> matches = searchTransactions(query);
+
+    std::cout << std::endl;
+    if (matches.empty()) {
+        std::cout << "No transactions match '" << query.text << "'." << std::endl;
+        std::cout << std::endl;
+        return;
+    }
+
+    std::cout << "================================================" << std::endl;
+    std::cout << matches.size() << " transactions matching '" << query.text << "':" << std::endl;
+    std::cout << "================================================" << std::endl;
+    for (size_t row : matches) {
+        std::cout << row + 1 << ". ";
+        transactions[row].display();
+    }
+    std::cout << "================================================" << std::endl;
+    std::cout << std::endl;
+}
+
+void TransactionManager::addToTotals(const Transaction& transaction) {
+    std::string type = transaction.getType();
+    if (type != "credit" && type != "debit") {
+        return;
+    }
+
+    CreditDebitTotals& totals = currencyTotals[transaction.getCurrency()][transaction.getCategory()];
+    if (type == "credit") {
+        totals.credit += transaction.getAmount();
+    } else {
+        totals.debit += transaction.getAmount();
+    }
+}
+
 void TransactionManager::trackCreditAndDebit() const {
-    float totalCredit = 0.0f, totalDebit = 0.0f;
+    double totalCredit = 0.0, totalDebit = 0.0;
 
-    for (const auto& transaction : transactions) {
-        if (transaction.getType() == "credit") {
-            totalCredit += transaction.getAmount();
-        } else if (transaction.getType() == "debit") {
-            totalDebit += transaction.getAmount();
+    for (const auto& [currency, categories] : currencyTotals) {
+        for (const auto& [category, totals] : categories) {
+            totalCredit += totals.credit;
+            totalDebit += totals.debit;
         }
     }
 
@@ -128,31 +262,55 @@ void TransactionManager::findMostSpentCategory() const {
         return;
     }
 
-    std::map<std::string, float> categorySpent;
-
-    for (const auto& transaction : transactions) {
-        if (transaction.getType() == "debit") {
-            categorySpent[transaction.getCategory()] += transaction.getAmount();
+    const GroupResult* maxCategory = nullptr;
+    std::vector<GroupResult> groups = GroupByEngine(GROUP_CATEGORY | GROUP_TYPE).run(transactions);
+    for (const auto& group : groups) {
+        if (group.type == "debit" && (!maxCategory || group.sum > maxCategory->sum)) {
+            maxCategory = &group;
         }
     }
 
-    if (categorySpent.empty()) {
+    if (!maxCategory) {
         std::cout << "No debit transactions found." << std::endl;
         return;
     }
 
-    auto maxCategory = std::max_element(categorySpent.begin(), categorySpent.end(),
-                                       [](const auto& a, const auto& b) {
-                                           return a.second < b.second;
-                                       });
-
     std::cout << std::endl;
     std::cout << std::fixed << std::setprecision(2);
-    std::cout << "Category with most spending: " << maxCategory->first 
-              << " (" << maxCategory->second << " " << defaultCurrency << ")" << std::endl;
+    std::cout << "Category with most spending: " << maxCategory->category 
+              << " (" << maxCategory->sum << " " << defaultCurrency << ")" << std::endl;
     std::cout << std::endl;
 }
 
+void TransactionManager::groupedReport() const {
+    std::string spec, csvFile;
+
+    std::cout << "Group by (c)ategory, (t)ype, c(u)rrency, (m)onth, e.g. 'cm': ";
+    std::cin >> spec;
+
+    unsigned dimensions = GroupByEngine::parseDimensions(spec);
+    if (dimensions == 0) {
+        std::cout << "Invalid grouping! Please use c, t, u and m." << std::endl;
+        return;
+    }
+
+    std::cout << "Export to CSV file (blank to skip): ";
+    std::cin.ignore();
+    std::getline(std::cin, csvFile);
+
+    GroupByEngine engine(dimensions);
+    std::vector<GroupResult> groups = engine.run(transactions);
+    engine.display(groups);
+
+    if (!csvFile.empty() && engine.exportCSV(csvFile, groups)) {
+        std::cout << "Report exported to " << csvFile << std::endl;
+    }
+}
+
+void TransactionManager::displayApproximateAnalytics() const {
+    sketches.display();
+}
+
 void TransactionManager::trackScholarshipsAndLoans() const {
     float totalScholarships = 0.0f, totalLoans = 0.0f;
 
@@ -251,26 +409,37 @@ void TransactionManager::displayTransactionsInCurrency(const std::string& target
     std::cout << std::endl;
 }
 
+void TransactionManager::getConvertedTotals(const std::string& targetCurrency, double& credit, double& debit,
+                                            const std::string& category) const {
+    credit = 0.0;
+    debit = 0.0;
+
+    for (const auto& [currency, categories] : currencyTotals) {
+        double currencyCredit = 0.0, currencyDebit = 0.0;
+        for (const auto& [name, totals] : categories) {
+            if (category.empty() || name == category) {
+                currencyCredit += totals.credit;
+                currencyDebit += totals.debit;
+            }
+        }
+
+        if (currencyCredit != 0.0) {
+            credit += converter->convertCurrency(currencyCredit, currency, targetCurrency);
+        }
+        if (currencyDebit != 0.0) {
+            debit += converter->convertCurrency(currencyDebit, currency, targetCurrency);
+        }
+    }
+}
+
 void TransactionManager::convertAllTransactionsTo(const std::string& targetCurrency) {
-    float totalCredit = 0.0f, totalDebit = 0.0f;
+    double totalCredit = 0.0, totalDebit = 0.0;
 
     std::cout << std::endl;
     std::cout << "Converting all transactions to " << targetCurrency << "..." << std::endl;
     std::cout << std::endl;
 
-    for (const auto& transaction : transactions) {
-        float convertedAmount = converter->convertCurrency(
-            transaction.getAmount(),
-            transaction.getCurrency(),
-            targetCurrency
-        );
-
-        if (transaction.getType() == "credit") {
-            totalCredit += convertedAmount;
-        } else if (transaction.getType() == "debit") {
-            totalDebit += convertedAmount;
-        }
-    }
+    getConvertedTotals(targetCurrency, totalCredit, totalDebit);
 
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "Total Credit: " << totalCredit << " " << targetCurrency << std::endl;
@@ -288,10 +457,38 @@ const std::vector<Transaction>& TransactionManager::getTransactions() const {
     return transactions;
 }
 
+const LedgerSketches& TransactionManager::getSketches() const {
+    return sketches;
+}
+
 void TransactionManager::setDefaultCurrency(const std::string& curr) {
     defaultCurrency = curr;
 }
 
+void TransactionManager::setBudgetEngine(BudgetEngine* engine) {
+    budgetEngine = engine;
+    if (!budgetEngine) {
+        return;
+    }
+
+    budgetEngine->resetTotals();
+    for (const auto& transaction : transactions) {
+        budgetEngine->evaluate(transaction);
+    }
+}
+
+size_t TransactionManager::getMemoryUsage() const {
+    size_t bytes = sizeof(*this) + transactions.capacity() * sizeof(Transaction);
+    for (const auto& transaction : transactions) {
+        bytes += transaction.getDescription().size() + transaction.getCategory().size();
+    }
+    return bytes + descriptionIndex.getMemoryUsage() + sketches.getMemoryUsage();
+}
+
 TransactionManager::~TransactionManager() {
-    saveTransactions();
+    // Unmodified ledgers are left untouched so read-only users (e.g. the
+    // ledger registry unloading shards) don't rewrite every file
+    if (modified) {
+        saveTransactions();
+    }
 }
\ No newline at end of file
@@ -3,15 +3,44 @@
 
 #include <vector>
 #include <string>
+#include <map>
 #include "transaction.hpp"
 #include "currency_converter.hpp"
+#include "description_index.hpp"
+#include "budget_engine.hpp"
+#include "ledger_sketches.hpp"
+
+// Description search with optional filters; empty strings match anything
+struct SearchQuery {
+    std::string text;
+    bool prefix = false;        // match at the start of the description only
+    std::string category;
+    std::string type;
+    float minAmount = 0.0f;
+    float maxAmount = -1.0f;    // negative means no upper bound
+};
+
+// Running credit/debit sums for one (currency, category) bucket
+struct CreditDebitTotals {
+    double credit = 0.0;
+    double debit = 0.0;
+};
 
 class TransactionManager {
 private:
     std::vector<Transaction> transactions;
+    // currency -> category -> totals in that currency. Conversion is linear,
+    // so converted totals need one conversion per bucket, not per row.
+    std::map<std::string, std::map<std::string, CreditDebitTotals>> currencyTotals;
+    DescriptionIndex descriptionIndex;
+    LedgerSketches sketches;        // persisted next to the ledger file
     std::string filename;
     CurrencyConverter* converter;
     std::string defaultCurrency;
+    bool modified;          // unsaved changes; the destructor only writes back when set
+    BudgetEngine* budgetEngine;     // optional, evaluated on every ingested row
+
+    void addToTotals(const Transaction& transaction);
 
 public:
     TransactionManager(const std::string& file, CurrencyConverter* curr);
@@ -19,14 +48,21 @@ public:
     // File operations
     void loadTransactions();
     void saveTransactions();
+    bool exportArchive(const std::string& archiveFile) const;  // block-compressed, see block_ledger.hpp
     
     // Transaction management
     void addTransaction();
     void displayAllTransactions() const;
+
+    // Search
+    std::vector<size_t> searchTransactions(const SearchQuery& query) const;
+    void searchByDescription() const;
     
     // Analytics
     void trackCreditAndDebit() const;
     void findMostSpentCategory() const;
+    void groupedReport() const;
+    void displayApproximateAnalytics() const;
     void trackScholarshipsAndLoans() const;
     void trackDues() const;
     void checkTransactionLimit(float limit) const;
@@ -35,11 +71,16 @@ public:
     void convertTransactionCurrency(int index, const std::string& targetCurrency);
     void displayTransactionsInCurrency(const std::string& targetCurrency);
     void convertAllTransactionsTo(const std::string& targetCurrency);
+    void getConvertedTotals(const std::string& targetCurrency, double& credit, double& debit,
+                            const std::string& category = "") const;   // empty category = all
 
     // Getters
     int getTransactionCount() const;
     const std::vector<Transaction>& getTransactions() const;
+    const LedgerSketches& getSketches() const;
     void setDefaultCurrency(const std::string& curr);
+    void setBudgetEngine(BudgetEngine* engine);   // replays existing rows through the rules
+    size_t getMemoryUsage() const;  // estimated bytes held by the loaded ledger
     
     ~TransactionManager();
 };
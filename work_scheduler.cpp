@@ -0,0 +1,108 @@
+#include "work_scheduler.hpp"
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <memory>
+
+namespace {
+
+struct WorkQueue {
+    std::mutex mutex;
+    std::deque<size_t> tasks;
+};
+
+// Owner takes from the back, thieves take from the front
+bool popOwn(WorkQueue& queue, size_t& task) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool steal(WorkQueue& queue, size_t& task) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+    return true;
+}
+
+}
+
+WorkScheduler::WorkScheduler(unsigned threads) : workerCount(threads) {
+    if (workerCount == 0) {
+        workerCount = std::thread::hardware_concurrency();
+    }
+    if (workerCount == 0) {
+        workerCount = 1;
+    }
+}
+
+void WorkScheduler::run(size_t taskCount, const std::function<void(size_t, unsigned)>& task) const {
+    if (taskCount == 0) {
+        return;
+    }
+
+    unsigned workers = workerCount;
+    if (taskCount < workers) {
+        workers = static_cast<unsigned>(taskCount);
+    }
+
+    if (workers == 1) {
+        for (size_t i = 0; i < taskCount; i++) {
+            task(i, 0);
+        }
+        return;
+    }
+
+    // Deal out contiguous slices; pushed in reverse so the owner walks its slice in order
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    for (unsigned w = 0; w < workers; w++) {
+        queues.push_back(std::make_unique<WorkQueue>());
+        size_t begin = taskCount * w / workers;
+        size_t end = taskCount * (w + 1) / workers;
+        for (size_t i = end; i > begin; i--) {
+            queues[w]->tasks.push_back(i - 1);
+        }
+    }
+
+    auto worker = [&](unsigned self) {
+        size_t index;
+        while (true) {
+            if (popOwn(*queues[self], index)) {
+                task(index, self);
+                continue;
+            }
+
+            // Tasks are never re-queued, so one empty sweep means everything is claimed
+            bool stole = false;
+            for (unsigned offset = 1; offset < workers && !stole; offset++) {
+                stole = steal(*queues[(self + offset) % workers], index);
+            }
+            if (!stole) {
+                return;
+            }
+            task(index, self);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned w = 1; w < workers; w++) {
+        threads.emplace_back(worker, w);
+    }
+    worker(0);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+unsigned WorkScheduler::getWorkerCount() const {
+    return workerCount;
+}
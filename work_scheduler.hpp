@@ -0,0 +1,25 @@
+#ifndef WORK_SCHEDULER_HPP
+#define WORK_SCHEDULER_HPP
+
+#include <cstddef>
+#include <functional>
+
+// Work-stealing scheduler for independent tasks numbered 0..taskCount-1.
+// Each worker starts with a contiguous slice of the tasks and, once its own
+// queue is drained, steals from the front of the other workers' queues, so a
+// few slow tasks (e.g. a huge ledger) don't leave the other cores idle.
+class WorkScheduler {
+private:
+    unsigned workerCount;
+
+public:
+    // threads == 0 uses std::thread::hardware_concurrency()
+    explicit WorkScheduler(unsigned threads = 0);
+
+    // Runs task(index, worker) for every index; worker is in [0, getWorkerCount())
+    void run(size_t taskCount, const std::function<void(size_t, unsigned)>& task) const;
+
+    unsigned getWorkerCount() const;
+};
+
+#endif